@@ -156,6 +156,34 @@ String AvionicsBoard::get_timestamp()
   return m_external_rtc.get_timestamp();
 }
 
+/**
+ * @brief Get the time from the external realtime clock
+ *
+ * @param[out] time current time
+ * @return true successful
+ * @return false clock not set, not readable, or outside the valid range
+ *
+ */
+
+bool AvionicsBoard::get_time(DateTime &time)
+{
+  if (!m_external_rtc.is_set())
+  {
+    return false;
+  }
+  if (!m_external_rtc.get_time(time))
+  {
+    Log.errorln("Error from external real time clock");
+    return false;
+  }
+  if ((time.year() < minimum_valid_year) || (time.year() > maximum_valid_year))
+  {
+    Log.errorln("Time outside valid range");
+    return false;
+  }
+  return true;
+}
+
 /**
  * @brief Set beacon interval
  *
@@ -447,6 +475,17 @@ void AvionicsBoard::service_watchdog()
   m_external_watchdog.service();
 }
 
+/**
+ * @brief Time at which the watchdog is next due to be triggered
+ *
+ * @return unsigned long time in milliseconds
+ */
+
+unsigned long AvionicsBoard::get_watchdog_due() const
+{
+  return m_external_watchdog.next_service_time();
+}
+
 /**
  * @brief Enable I2C bus switch
  *
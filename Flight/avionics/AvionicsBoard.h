@@ -40,6 +40,7 @@ public:
    void watchdog_force_reset();
    bool set_external_rtc(const DateTime time);
    String get_timestamp();
+   bool get_time(DateTime &time);
    bool set_beacon_interval(const int seconds);
    bool check_beacon();
    AvionicsBeacon get_status();
@@ -51,6 +52,7 @@ public:
    String get_telemetry();
    String get_beacon_interval();
    void service_watchdog();
+   unsigned long get_watchdog_due() const;
    String read_fram(const size_t address);
    bool unset_clock();
    bool get_stability();
@@ -0,0 +1,27 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat beacon messages
+ *
+ * This file implements sending the beacon
+ *
+ */
+
+#include "Beacon.h"
+#include "RadioBoard.h"
+#include "log_utility.h"
+
+/**
+ * @brief Send beacon via the Radio Board
+ *
+ * @return true success
+ * @return false error
+ *
+ */
+
+bool Beacon::send() const
+{
+    Log.verboseln("Beacon: %c%c%c", m_beacon[0], m_beacon[1], m_beacon[2]);
+    extern RadioBoard radio;
+    const Fragment fragment{m_beacon, beacon_length};
+    return radio.send_message(Message::beacon, &fragment, 1);
+}
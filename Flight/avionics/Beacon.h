@@ -2,8 +2,8 @@
  * @author Lee A. Congdon (lee@silversat.org)
  * @brief SilverSat beacon messages
  *
- * This file implements the Beacon class, which inherits from Message. Beacons are sent
- * at intervals and includes status for the Power, Avionics, and Payload boards.
+ * This file implements the Beacon class. Beacons are sent at intervals and include
+ * status for the Power, Avionics, and Payload boards.
  *
  * Beacon timing relies on a microcontroller timer. The realtime clock is not used for beacon timing.
  *
@@ -29,6 +29,7 @@ enum class PowerBeacon
     fair,
     poor,
     unknown,
+    count
 };
 
 /**
@@ -51,6 +52,7 @@ enum class AvionicsBeacon
     power_board_initialization_error,
     watchdog_reset,
     unknown,
+    count
 };
 
 /**
@@ -92,14 +94,49 @@ enum class PayloadBeacon
     communicate_8_10,
     communicate_timeout,
     unknown,
+    count
 };
 
+/**
+ * @brief Beacon characters indexed by status
+ *
+ * Ground tools decode beacons from these tables and the enumerations above
+ *
+ */
+
+constexpr char power_beacon_codes[]{"SEITA"};                              /**< PowerBeacon characters @hideinitializer */
+constexpr char avionics_beacon_codes[]{"ESAHNUIDRT5"};                     /**< AvionicsBeacon characters @hideinitializer */
+constexpr char payload_beacon_codes[]{"EPXZO37JDNIRUB4VGKAWHCS5FLTM60"}; /**< PayloadBeacon characters @hideinitializer */
+
+static_assert(sizeof(power_beacon_codes) - 1 == static_cast<size_t>(PowerBeacon::count), "Power beacon table does not match PowerBeacon");
+static_assert(sizeof(avionics_beacon_codes) - 1 == static_cast<size_t>(AvionicsBeacon::count), "Avionics beacon table does not match AvionicsBeacon");
+static_assert(sizeof(payload_beacon_codes) - 1 == static_cast<size_t>(PayloadBeacon::count), "Payload beacon table does not match PayloadBeacon");
+
+constexpr size_t beacon_length{3}; /**< characters in beacon @hideinitializer */
+
+/**
+ * @brief Look up the beacon character for a status
+ *
+ * @param codes table for the status enumeration, the last entry is for unknown status
+ * @param status status to encode
+ * @return char beacon character, unknown if status is out of range
+ *
+ */
+
+template <size_t Size, typename Status>
+constexpr char beacon_code(const char (&codes)[Size], const Status status)
+{
+    return static_cast<size_t>(status) < Size - 1 ? codes[static_cast<size_t>(status)] : codes[Size - 2];
+}
+
 /**
  * @brief Beacon message
  *
+ * The beacon is a fixed length frame of type Message::beacon, held as characters
+ *
  */
 
-class Beacon final : public Message
+class Beacon final
 {
 public:
     /**
@@ -111,128 +148,14 @@ public:
      */
 
     Beacon(const PowerBeacon power_beacon, const AvionicsBeacon avionics_beacon, const PayloadBeacon payload_beacon)
-        : Message{beacon, convert_power_beacon(power_beacon) + convert_avionics_status(avionics_beacon) + convert_payload_status(payload_beacon)}
+        : m_beacon{beacon_code(power_beacon_codes, power_beacon),
+                   beacon_code(avionics_beacon_codes, avionics_beacon),
+                   beacon_code(payload_beacon_codes, payload_beacon)}
     {
     }
 
-private:
-    const String convert_power_beacon(const PowerBeacon power_beacon)
-    {
-        switch (power_beacon)
-        {
-        case PowerBeacon::excellent:
-            return "S";
-        case PowerBeacon::good:
-            return "E";
-        case PowerBeacon::fair:
-            return "I";
-        case PowerBeacon::poor:
-            return "T";
-        case PowerBeacon::unknown:
-            return "A";
-        default:
-            return "A";
-        }
-    }
+    bool send() const;
 
-    const String convert_avionics_status(const AvionicsBeacon avionics_beacon)
-    {
-        switch (avionics_beacon)
-        {
-        case AvionicsBeacon::everything_ok:
-            return "E";
-        case AvionicsBeacon::unknown_time:
-            return "S";
-        case AvionicsBeacon::FRAM_initialization_error:
-            return "A";
-        case AvionicsBeacon::antenna_deployment_error:
-            return "H";
-        case AvionicsBeacon::imu_initialization_error:
-            return "N";
-        case AvionicsBeacon::radio_connection_error:
-            return "U";
-        case AvionicsBeacon::unstable:
-            return "I";
-        case AvionicsBeacon::rtc_initialization_error:
-            return "D";
-        case AvionicsBeacon::power_board_initialization_error:
-            return "R";
-        case AvionicsBeacon::watchdog_reset:
-            return "T";
-        case AvionicsBeacon::unknown:
-            return "5";
-        default:
-            return "5";
-        }
-    }
-
-    const String convert_payload_status(PayloadBeacon payload_beacon)
-    {
-        switch (payload_beacon)
-        {
-        case PayloadBeacon::none:
-            return "E";
-        case PayloadBeacon::overcurrent_0_1:
-            return "P";
-        case PayloadBeacon::overcurrent_1_2:
-            return "X";
-        case PayloadBeacon::overcurrent_2_4:
-            return "Z";
-        case PayloadBeacon::overcurrent_4_6:
-            return "O";
-        case PayloadBeacon::overcurrent_6_8:
-            return "3";
-        case PayloadBeacon::overcurrent_8_10:
-            return "7";
-        case PayloadBeacon::overcurrent_timeout:
-            return "J";
-        case PayloadBeacon::photo_0_1:
-            return "D";
-        case PayloadBeacon::photo_1_2:
-            return "N";
-        case PayloadBeacon::photo_2_4:
-            return "I";
-        case PayloadBeacon::photo_4_6:
-            return "R";
-        case PayloadBeacon::photo_6_8:
-            return "U";
-        case PayloadBeacon::photo_8_10:
-            return "B";
-        case PayloadBeacon::photo_timeout:
-            return "4";
-        case PayloadBeacon::SSDV_0_1:
-            return "V";
-        case PayloadBeacon::SSDV_1_2:
-            return "G";
-        case PayloadBeacon::SSDV_2_4:
-            return "K";
-        case PayloadBeacon::SSDV_4_6:
-            return "A";
-        case PayloadBeacon::SSDV_6_8:
-            return "W";
-        case PayloadBeacon::SSDV_8_10:
-            return "H";
-        case PayloadBeacon::SSDV_timeout:
-            return "C";
-        case PayloadBeacon::communicate_0_1:
-            return "S";
-        case PayloadBeacon::communicate_1_2:
-            return "5";
-        case PayloadBeacon::communicate_2_4:
-            return "F";
-        case PayloadBeacon::communicate_4_6:
-            return "L";
-        case PayloadBeacon::communicate_6_8:
-            return "T";
-        case PayloadBeacon::communicate_8_10:
-            return "M";
-        case PayloadBeacon::communicate_timeout:
-            return "6";
-        case PayloadBeacon::unknown:
-            return "0";
-
-        default:
-            return "0";
-        }
-    }
-};
\ No newline at end of file
+private:
+    char m_beacon[beacon_length];
+};
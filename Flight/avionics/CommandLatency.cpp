@@ -0,0 +1,103 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat command latency
+ *
+ * This file implements the class which keeps a log2 histogram of the time spent processing
+ * each ground command and the longest time spent in each processing stage
+ *
+ */
+
+#include "CommandLatency.h"
+
+/**
+ * @brief Count the time spent processing a command
+ *
+ * @param command command index in the warehouse
+ * @param microseconds time spent in each stage, zero for a stage which was not timed
+ *
+ */
+
+void CommandLatency::record(const size_t command, const uint32_t (&microseconds)[stage_count])
+{
+    if (command >= warehouse_command_count)
+    {
+        return;
+    }
+    auto &statistics{m_statistics[command]};
+    uint32_t total{0};
+    for (size_t stage{0}; stage < stage_count; ++stage)
+    {
+        total += microseconds[stage];
+        if (microseconds[stage] > statistics.maximum[stage])
+        {
+            statistics.maximum[stage] = microseconds[stage];
+        }
+    }
+    statistics.total.record(total);
+}
+
+/**
+ * @brief Check for counts for a command
+ *
+ * @param command command index in the warehouse
+ * @return true at least one time recorded
+ * @return false no times recorded
+ *
+ */
+
+bool CommandLatency::recorded(const size_t command) const
+{
+    return command < warehouse_command_count && !m_statistics[command].total.empty();
+}
+
+/**
+ * @brief Format the statistics for a command
+ *
+ * @param command command index in the warehouse
+ * @param[out] buffer formatted statistics, zero terminated
+ * @param capacity size of buffer
+ * @return size_t characters formatted
+ *
+ * The total time histogram, which is a space, the hexadecimal index of the first nonzero
+ * bucket, a hyphen, and two hexadecimal digits for each bucket through the last nonzero
+ * bucket, followed by a space and the longest parse, verify, acknowledge, and execute
+ * microseconds separated by spaces.
+ *
+ */
+
+size_t CommandLatency::format(const size_t command, char *buffer, const size_t capacity) const
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+    buffer[0] = '\0';
+    if (command >= warehouse_command_count)
+    {
+        return 0;
+    }
+    const auto &statistics{m_statistics[command]};
+    auto length{statistics.total.format(buffer, capacity)};
+    auto written{snprintf(buffer + length, capacity - length, " %lu %lu %lu %lu",
+                          static_cast<unsigned long>(statistics.maximum[parse]), static_cast<unsigned long>(statistics.maximum[verify]),
+                          static_cast<unsigned long>(statistics.maximum[acknowledge]), static_cast<unsigned long>(statistics.maximum[execute]))};
+    if (written < 0 || static_cast<size_t>(written) >= capacity - length)
+    {
+        buffer[length] = '\0';
+        return length;
+    }
+    return length + static_cast<size_t>(written);
+}
+
+/**
+ * @brief Reset all statistics
+ *
+ */
+
+void CommandLatency::clear()
+{
+    for (auto &statistics : m_statistics)
+    {
+        statistics = Statistics{};
+    }
+}
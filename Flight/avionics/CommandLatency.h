@@ -0,0 +1,64 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat command latency
+ *
+ * This file declares the class which keeps a log2 histogram of the time spent processing
+ * each ground command and the longest time spent in each processing stage
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+#include "CommandWarehouse.h"
+#include "Log2Histogram.h"
+
+constexpr size_t latency_bucket_count{16}; /**< buckets in each histogram @hideinitializer */
+constexpr uint8_t latency_first_log2{5};   /**< bucket 0 holds times below 2^5 microseconds @hideinitializer */
+
+using LatencyHistogram = Log2Histogram<uint8_t, latency_bucket_count, latency_first_log2>; /**< histogram of command times */
+
+/**
+ * @brief Command latency statistics
+ *
+ * For each command in the warehouse, a histogram of the total processing time, whose
+ * bucket 0 counts times below 32 microseconds, and the longest time in each stage.
+ *
+ */
+
+class CommandLatency final
+{
+public:
+    /**
+     * @brief Command processing stages
+     *
+     */
+
+    enum Stage : uint8_t
+    {
+        parse,       /**< tokenize, look up, validate, and load arguments */
+        verify,      /**< check sequence number and signature */
+        acknowledge, /**< send acknowledgement */
+        execute,     /**< execute and respond */
+        stage_count,
+    };
+
+    void record(const size_t command, const uint32_t (&microseconds)[stage_count]);
+    bool recorded(const size_t command) const;
+    size_t format(const size_t command, char *buffer, const size_t capacity) const;
+    void clear();
+
+private:
+    /**
+     * @brief Statistics for one command
+     *
+     */
+
+    struct Statistics
+    {
+        LatencyHistogram total;          /**< time spent in all stages */
+        uint32_t maximum[stage_count]{}; /**< longest time in each stage in microseconds */
+    };
+
+    Statistics m_statistics[warehouse_command_count]{}; // statistics indexed by command
+};
@@ -14,19 +14,6 @@
 #include "AvionicsBoard.h"
 #include "RadioBoard.h"
 #include "PowerBoard.h"
-#include "arduino_secrets.h"
-#include "BLAKE2s.h"
-
-// Command constants
-
-constexpr auto hmac_length{32};                                                                                       /**< HMAC length in bytes */
-constexpr auto hmac_length_hex_ascii{hmac_length * 2};                                                                /**< HMAC length as hex characters */
-constexpr auto salt_length{8};                                                                                        /**< Salt length in bytes */
-constexpr auto salt_length_hex_ascii{salt_length * 2};                                                                /**< Salt length as hex characters */
-constexpr auto sequence_length{4};                                                                                    /**< Sequence length in bytes */
-constexpr auto sequence_length_hex_ascii{sequence_length * 2};                                                        /**< Sequence length as hex characters */
-constexpr auto signature_length_hex_ascii{hmac_length_hex_ascii + salt_length_hex_ascii + sequence_length_hex_ascii}; /**< Signature length as hex ascii */
-constexpr auto radio_response_limit{191};                                                                             /**< Radio response limit, does not include 'RES GRS ' */
 
 /**
  * @brief Helper function to determine if a string is hexadecimal digits
@@ -67,18 +54,20 @@ int char2int(const char input)
  * @brief Convert hexadecimal text representation to binary values
  *
  * @param src hexadecimal representation
+ * @param length number of hexadecimal characters to convert
  * @param target binary values
  */
 
-// This function assumes src to be a zero terminated sanitized string with
-// an even number of [0-9a-f] characters and target to be sufficiently large
+// This function assumes src to be a sanitized string with an even number of
+// [0-9a-f] characters and target to be sufficiently large
 
-void hex2bin(const char *src, byte *target)
+void hex2bin(const char *src, size_t length, byte *target)
 {
-    while (*src && src[1])
+    while (length > 1 && *src && src[1])
     {
         *(target++) = (char2int(*src) << 4) + char2int(src[1]);
         src += 2;
+        length -= 2;
     }
 };
 
@@ -88,145 +77,444 @@ void hex2bin(const char *src, byte *target)
  * @return true no command or successful
  * @return false error
  *
- * Check to determine if the Radio Board has received a frame. If so, either
- * validate, acknowledge and execute ground command or process local message
+ * Check to determine if the Radio Board has received frames. Process each frame
+ * waiting at the start of the pass
  *
  */
+
 bool CommandProcessor::check_for_command()
 {
     extern RadioBoard radio;
-    if (radio.receive_frame())
+    auto status{true};
+    auto pending{radio.receive_frames()};
+    while (pending > 0)
     {
-        auto frame{radio.get_frame()};
-        Log.noticeln("Frame received on serial port");
-        auto command_code{frame.type};
-        Log.verboseln("Command code: %x", command_code);
-        String command_string{frame.command};
-        Log.verboseln("Command string: %s", command_string.c_str());
+        status = process_frame(radio.get_frame()) && status;
+        radio.release_frame();
+        --pending;
+    }
+    return status;
+}
+
+/**
+ * @brief Process frame from Radio Board
+ *
+ * @param frame received frame
+ * @return true successful
+ * @return false error
+ *
+ * Either validate, acknowledge and execute ground command or process local message
+ *
+ */
+
+bool CommandProcessor::process_frame(const Frame &frame)
+{
+    Log.noticeln("Frame received on serial port");
+    auto command_code{frame.type};
+    Log.verboseln("Command code: %x", command_code);
+    if (command_code != REMOTE_BINARY_FRAME)
+    {
+        Log.verboseln("Command string: %s", frame.command);
+    }
 
-        switch (command_code)
+    switch (command_code)
+    {
+    // Ground command, text or binary signature
+    case REMOTE_FRAME:
+    case REMOTE_BINARY_FRAME:
+    {
+        auto verify_start{micros()};
+        auto valid_signature{validate_signature(frame)};
+        m_verify_time = micros() - verify_start;
+        if (!valid_signature)
         {
-        // Ground command
-        case REMOTE_FRAME:
+            m_verify_time = 0;
+            Log.errorln("Invalid digital signature");
+            Message message{Message::negative_acknowledgement, NACK + " " + get_sequence()};
+            message.send();
+            return false;
+        }
+        Log.verboseln("Command signature is valid");
+        auto command_text{frame.command + frame.signature_length};
+        auto command_length{frame.length - frame.signature_length};
+        constexpr size_t marker_length{sizeof(batch_marker) - 1};
+        if (command_length >= marker_length && memcmp(command_text, batch_marker, marker_length) == 0)
         {
-            auto valid_signature{validate_signature(command_string)};
-            if (!valid_signature)
+            return process_batch(command_text + marker_length, command_length - marker_length);
+        }
+        return execute_command(command_text, command_length);
+    }
+    // Local response
+    case LOCAL_FRAME:
+    {
+        String command_string{frame.command};
+        if (command_string.startsWith(RES))
+        {
+            auto response_type_end{command_string.indexOf(' ', RES.length() + 1)};
+            auto response_type_char{command_string.substring(RES.length() + 1, response_type_end)};
+            auto response_type_length{response_type_char.length()};
+            if (!is_hex(response_type_char) || response_type_char.length() < 1 || response_type_char.length() > 2)
             {
-                Log.errorln("Invalid digital signature");
-                Message message{Message::negative_acknowledgement, NACK + " " + get_sequence()};
-                message.send();
+                Log.errorln("Invalid response type");
                 return false;
             }
-            Log.verboseln("Command signature is valid");
-            Command *command{get_command(command_string.substring(signature_length_hex_ascii))};
-            command->acknowledge_receipt();
-            Log.traceln("Acknowledge completed");
-
-            if (command->execute())
+            if ((response_type_length % 2) != 0)
+            {
+                response_type_char = "0" + response_type_char; // hex2bin requires even number of characters
+            }
+            byte response_type{};
+            hex2bin(response_type_char.c_str(), response_type_char.length(), &response_type);
+            auto radio_data{command_string.substring(RES.length() + 1 + response_type_length + 1)};
+            if (radio_data.length() == 0)
             {
-                Log.traceln("Executed (%l executed, %l failed)", ++m_successful_commands, m_failed_commands);
-                return true;
+                Log.verboseln("Response type: %X", response_type);
             }
             else
             {
-                Log.errorln("Failed (%l executed, %l failed)", m_successful_commands, ++m_failed_commands);
-                return false;
+                Log.verboseln("Response type: %X, content: %s", response_type, radio_data.c_str());
             }
-            break;
-        }
-        // Local response
-        case LOCAL_FRAME:
-        {
-            if (command_string.startsWith(RES))
+            extern RadioBoard radio;
+            const auto radio_data_length{radio_data.length() < radio_response_limit ? radio_data.length() : radio_response_limit};
+            switch (response_type)
+            {
+            case GET_RADIO_STATUS:
+            {
+                const Fragment fragments[]{{"RES GRS ", 8}, {radio_data.c_str(), radio_data_length}};
+                radio.send_message(Message::response, fragments, 2);
+                break;
+            }
+            case BACKGROUND_RSSI:
             {
-                auto response_type_end{command_string.indexOf(' ', RES.length() + 1)};
-                auto response_type_char{command_string.substring(RES.length() + 1, response_type_end)};
-                auto response_type_length{response_type_char.length()};
-                if (!is_hex(response_type_char) || response_type_char.length() < 1 || response_type_char.length() > 2)
-                {
-                    Log.errorln("Invalid response type");
-                    return false;
-                }
-                if ((response_type_length % 2) != 0)
-                {
-                    response_type_char = "0" + response_type_char; // hex2bin requires even number of characters
-                }
-                byte response_type{};
-                hex2bin(response_type_char.c_str(), &response_type);
-                auto radio_data{command_string.substring(RES.length() + 1 + response_type_length + 1)};
-                if (radio_data.length() == 0)
-                {
-                    Log.verboseln("Response type: %X", response_type);
-                }
-                else
-                {
-                    Log.verboseln("Response type: %X, content: %s", response_type, radio_data.c_str());
-                }
-                switch (response_type)
-                {
-                case GET_RADIO_STATUS:
-                    Response{"GRS " + radio_data.substring(0, radio_response_limit)}.send();
-                    break;
-                case BACKGROUND_RSSI:
-                    Response{"RBR " + radio_data.substring(0, radio_response_limit)}.send();    
-                    break;
-                default:
-                    break;
-                }
+                const Fragment fragments[]{{"RES RBR ", 8}, {radio_data.c_str(), radio_data_length}};
+                radio.send_message(Message::response, fragments, 2);
+                break;
             }
-            break;
+            case MODIFY_BAUD_RATE:
+                radio.baud_rate_response(static_cast<uint32_t>(radio_data.toInt()));
+                break;
+            default:
+                break;
+            }
+        }
+        break;
+    }
+    // Cycle radio 5v
+    case TOGGLE_RADIO_5V:
+    {
+        if (frame.length == 0 && command_code == TOGGLE_RADIO_5V)
+        {
+            Log.verboseln("Received reset 5v from radio");
+            extern PowerBoard power;
+            power.cycle_radio_5v();
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return true;
+}
+
+/**
+ * @brief Acknowledge and execute one ground command
+ *
+ * @param buffer command and arguments, tokenized in place
+ * @param length characters in buffer
+ * @return true successful
+ * @return false error
+ *
+ */
+
+bool CommandProcessor::execute_command(char *buffer, const size_t length)
+{
+    auto start{micros()};
+    Command *command{get_command(buffer, length)};
+    auto parsed{micros()};
+    command->acknowledge_receipt();
+    auto acknowledged{micros()};
+    Log.traceln("Acknowledge completed");
+    auto status{command->execute()};
+    auto executed{micros()};
+
+    const uint32_t stages[CommandLatency::stage_count]{static_cast<uint32_t>(parsed - start), m_verify_time,
+                                                       static_cast<uint32_t>(acknowledged - parsed), static_cast<uint32_t>(executed - acknowledged)};
+    m_latency.record(command_warehouse.RetrievedIndex(), stages);
+    m_verify_time = 0; // verification is shared by the commands in a batch
+
+    if (status)
+    {
+        Log.traceln("Executed (%l executed, %l failed)", ++m_successful_commands, m_failed_commands);
+        return true;
+    }
+    else
+    {
+        Log.errorln("Failed (%l executed, %l failed)", m_successful_commands, ++m_failed_commands);
+        return false;
+    }
+}
+
+/**
+ * @brief Process a batch of ground commands
+ *
+ * @param commands newline separated commands covered by one signature, following the batch marker
+ * @param length characters in commands
+ * @return true all commands successful
+ * @return false error, remaining commands not executed
+ *
+ * The batch is acknowledged once. Commands are executed in order until one fails,
+ * and their responses are collected and sent as RES BAT with the number of commands
+ * completed and the number in the batch. Collected responses which do not fit in one
+ * frame are sent first as RES BAT+.
+ *
+ */
+
+bool CommandProcessor::process_batch(char *commands, const size_t length)
+{
+    Log.verboseln("Processing command batch");
+    Message acknowledgement{Message::acknowledgement, ACK + " " + get_sequence()};
+    acknowledgement.send();
+
+    m_collection = Collection::batch;
+    m_collected_length = 0;
+    Message::set_collector(this);
+    auto status{true};
+    size_t command_count{0};
+    size_t completed{0};
+    size_t start{0};
+    while (start < length)
+    {
+        auto end{start};
+        while (end < length && commands[end] != '\n')
+        {
+            ++end;
+        }
+        auto blank{true};
+        for (auto index{start}; index < end && blank; ++index)
+        {
+            blank = isspace(commands[index]);
         }
-        // Cycle radio 5v
-        case TOGGLE_RADIO_5V:
+        if (!blank)
         {
-            if (command_string.length() == 0 && command_code == TOGGLE_RADIO_5V)
+            ++command_count;
+            if (status)
             {
-                Log.verboseln("Received reset 5v from radio");
-                extern PowerBoard power;
-                power.cycle_radio_5v();
+                commands[end] = '\0';
+                status = execute_command(commands + start, end - start);
+                completed += status ? 1 : 0;
             }
-            break;
-        }
-        default:
-            break;
         }
+        start = end + 1;
+    }
+    Message::set_collector(nullptr);
+    m_collection = Collection::none;
+
+    Log.verboseln("Batch completed %d of %d commands", completed, command_count);
+    send_batch_responses(String{"RES BAT "} + String{completed} + " " + String{command_count});
+    return status;
+}
+
+/**
+ * @brief Execute a stored command whose time has been reached
+ *
+ * @return true no command due or successful
+ * @return false error
+ *
+ * At most one stored command is executed on each pass so that the process loop
+ * continues to service the watchdog and the Radio Board.
+ *
+ */
+
+bool CommandProcessor::check_stored_commands()
+{
+    if (m_stored_commands.size() == 0)
+    {
+        return true;
+    }
+    extern AvionicsBoard avionics;
+    DateTime time{};
+    if (!avionics.get_time(time))
+    {
+        return false;
     }
+    if (m_stored_commands.next_time() > time.unixtime())
+    {
+        return true;
+    }
+    auto entry{m_stored_commands.take()};
+    return execute_stored_command(entry);
+}
+
+/**
+ * @brief Execute a stored command and record the result
+ *
+ * @param entry stored command, tokenized in place
+ * @return true successful
+ * @return false error
+ *
+ * The command is not acknowledged and its responses are kept with the result for
+ * later downlink.
+ *
+ */
+
+bool CommandProcessor::execute_stored_command(StoredCommands::Entry &entry)
+{
+    Log.noticeln("Executing stored command: %s", entry.text);
+    m_collection = Collection::stored;
+    m_collected_length = 0;
+    m_verify_time = 0; // verified when stored
+    Message::set_collector(this);
+    auto status{execute_command(entry.text, strlen(entry.text))};
+    Message::set_collector(nullptr);
+    m_collection = Collection::none;
+    m_stored_commands.record_result(entry.time, status, entry.text, m_collected_responses, m_collected_length);
+    return status;
+}
+
+/**
+ * @brief Get the stored commands
+ *
+ * @return StoredCommands& commands awaiting execution and their results
+ *
+ */
+
+StoredCommands &CommandProcessor::get_stored_commands()
+{
+    return m_stored_commands;
+}
+
+/**
+ * @brief Get the command latency histograms
+ *
+ * @return CommandLatency& histograms indexed by command
+ *
+ */
+
+CommandLatency &CommandProcessor::get_command_latency()
+{
+    return m_latency;
+}
+
+/**
+ * @brief Get the name of a command
+ *
+ * @param index command index used by the latency histograms
+ * @return const char* command name
+ *
+ */
+
+const char *CommandProcessor::get_command_name(const size_t index) const
+{
+    return command_warehouse.CommandName(index);
+}
+
+/**
+ * @brief Get the number of commands
+ *
+ */
+
+size_t CommandProcessor::get_command_count() const
+{
+    return command_warehouse.CommandCount();
+}
+
+/**
+ * @brief Check whether responses are being collected
+ *
+ * @return true batch or stored command active, acknowledgements are suppressed and responses collected
+ * @return false responses are sent
+ *
+ */
+
+bool CommandProcessor::collecting_responses() const
+{
+    return m_collection != Collection::none;
+}
+
+/**
+ * @brief Collect a response while a command batch or stored command is processed
+ *
+ * @param content response content
+ * @return true response collected
+ * @return false responses not being collected, response must be sent
+ *
+ * Installed as the message collector only while a batch or stored command is processed.
+ * Batch responses which do not fit are sent, stored command responses which do not fit are truncated
+ *
+ */
+
+bool CommandProcessor::collect_response(const String &content)
+{
+    if (m_collection == Collection::none)
+    {
+        return false;
+    }
+    auto text{content.c_str()};
+    size_t length{content.length()};
+    if (content.startsWith(RES + " "))
+    {
+        text += RES.length() + 1;
+        length -= RES.length() + 1;
+    }
+    if (m_collection == Collection::batch && m_collected_length + 1 + length > batch_response_limit)
+    {
+        send_batch_responses("RES BAT+");
+    }
+    if (m_collected_length + 1 >= batch_response_limit)
+    {
+        return true;
+    }
+    if (m_collected_length + 1 + length > batch_response_limit)
+    {
+        length = batch_response_limit - m_collected_length - 1;
+    }
+    m_collected_responses[m_collected_length++] = ' ';
+    memcpy(m_collected_responses + m_collected_length, text, length);
+    m_collected_length += length;
     return true;
 }
 
+/**
+ * @brief Send the collected batch responses
+ *
+ * @param header frame content preceding the responses
+ *
+ * Waits for transmit queue space first, since a batch may send several frames in a row
+ * and ResponsePacker does not wait while responses are collected
+ *
+ */
+
+void CommandProcessor::send_batch_responses(const String &header)
+{
+    extern RadioBoard radio;
+    radio.wait_for_transmit_space(kiss_encoded_limit(header.length() + m_collected_length));
+    const Fragment fragments[]{{header.c_str(), header.length()}, {m_collected_responses, m_collected_length}};
+    radio.send_message(Message::response, fragments, 2);
+    m_collected_length = 0;
+}
+
 /**
  * @brief Validate command signature
  *
- * @param buffer
+ * @param frame ground command frame
  * return true valid signature
  *
- * Validate the signature for ground commands
+ * Validate the sequence number and the signature verified as the frame was received
  *
  */
 
-bool CommandProcessor::validate_signature(const String &buffer)
+bool CommandProcessor::validate_signature(const Frame &frame)
 {
     Log.verboseln("Validating command signature");
 
-    if (buffer.length() < signature_length_hex_ascii)
+    if (frame.length < frame.signature_length)
     {
         Log.errorln("Invalid command length");
         return false;
     }
 
-    String hmac_hex_ascii{buffer.substring(0, hmac_length_hex_ascii)};
-    // Log.verboseln("HMAC: %s", hmac_hex_ascii.c_str());
-    byte hmac[hmac_length]{};
-    hex2bin(hmac_hex_ascii.c_str(), hmac);
-
-    String salt_hex_ascii{buffer.substring(hmac_length_hex_ascii, hmac_length_hex_ascii + salt_length_hex_ascii)};
-    // Log.verboseln("Salt: %s", salt_hex_ascii.c_str());
-    byte salt[salt_length]{};
-    hex2bin(salt_hex_ascii.c_str(), salt);
-
-    String sequence_hex_ascii{buffer.substring(hmac_length_hex_ascii + salt_length_hex_ascii, hmac_length_hex_ascii + salt_length_hex_ascii + sequence_length_hex_ascii)};
-    Log.verboseln("Sequence: %s", sequence_hex_ascii.c_str());
-    if (m_command_sequence <= sequence_hex_ascii.toInt())
+    auto sequence{frame.sequence};
+    Log.verboseln("Sequence: %l", sequence);
+    if (m_command_sequence <= sequence)
     {
         Log.verboseln("Sequence number is valid");
         ++m_command_sequence;
@@ -236,40 +524,32 @@ bool CommandProcessor::validate_signature(const String &buffer)
         Log.errorln("Invalid sequence number, expected number equal to or greater than %l", m_command_sequence);
         return false;
     }
-    String command{buffer.substring(signature_length_hex_ascii)};
-    Log.verboseln("Command: %s", command.c_str());
-
-    BLAKE2s blake{};
-    byte secret[]{SECRET_HASH_KEY};
-    byte computed_hmac[hmac_length]{};
-    blake.resetHMAC(secret, sizeof(secret));
-    blake.update(salt, salt_length);
-    blake.update(sequence_hex_ascii.c_str(), sequence_length_hex_ascii);
-    blake.update(command.c_str(), buffer.length() - signature_length_hex_ascii);
-    blake.finalizeHMAC(secret, sizeof(secret), computed_hmac, hmac_length);
-    return memcmp(computed_hmac, hmac, hmac_length) == 0;
+    Log.verboseln("Command: %s", frame.command + frame.signature_length);
+
+    // HMAC computed by the Radio Board interface as the frame was received
+
+    return frame.signature_valid;
 }
 
 /**
  * @brief Retrieve command object
  *
- * @param buffer
+ * @param buffer command and arguments
+ * @param length characters in buffer
  * @return next command to process
  *
  * For ground commands parse parameters and retrieve Command object
  *
  */
 
-Command *CommandProcessor::get_command(const String &buffer)
+Command *CommandProcessor::get_command(char *buffer, const size_t length)
 {
 
     // tokenize the command string and retrieve the command object
 
-    String command_string{buffer};
     size_t token_count{0};
-    String command_tokens[command_parameter_limit]{};
-    command_string.trim();
-    if (parse_parameters(command_string, command_tokens, token_count))
+    CommandToken command_tokens[command_parameter_limit]{};
+    if (parse_parameters(buffer, length, command_tokens, token_count))
     {
         Log.traceln("Retrieving command object");
         return command_warehouse.RetrieveCommand(command_tokens, token_count);
@@ -277,7 +557,7 @@ Command *CommandProcessor::get_command(const String &buffer)
     else
     {
         Log.errorln("Invalid command");
-        String invalid[]{"Invalid"};
+        const CommandToken invalid[]{{"Invalid", 7}};
         return command_warehouse.RetrieveCommand(invalid, 1);
     }
 }
@@ -285,38 +565,21 @@ Command *CommandProcessor::get_command(const String &buffer)
 /**
  * @brief Parse command parameters
  *
- * @param[in] command_string command string
- * @param[out] command_tokens tokens
+ * @param[in,out] command command text, separators are replaced with terminators
+ * @param length characters in command
+ * @param[out] command_tokens tokens referring to the command text
  * @param[out] token_count number of tokens
  * @return true successful
  * @return false failure
  */
 
-bool CommandProcessor::parse_parameters(const String &command_string, String command_tokens[], size_t &token_count)
+bool CommandProcessor::parse_parameters(char *command, const size_t length, CommandToken command_tokens[], size_t &token_count)
 {
-    size_t token_index{0};
-    String command{command_string};
-    while (command.length() > 0)
+    if (!tokenize(command, length, command_tokens, command_parameter_limit, token_count))
     {
-        if (token_index >= command_parameter_limit)
-        {
-            Log.warningln("Too many command parameters");
-            return false;
-        }
-        command.trim();
-        int next_blank{command.indexOf(' ')};
-        if (next_blank == -1)
-        {
-            command_tokens[token_index++] = command;
-            command = "";
-        }
-        else
-        {
-            command_tokens[token_index++] = command.substring(0, static_cast<unsigned int>(next_blank));
-            command = command.substring(static_cast<unsigned int>(next_blank));
-        }
+        Log.warningln("Too many command parameters");
+        return false;
     }
-    token_count = token_index;
     return true;
 }
 
@@ -10,21 +10,57 @@
 #pragma once
 
 #include "CommandWarehouse.h"
+#include "RadioBoard.h"
+#include "StoredCommands.h"
+#include "CommandLatency.h"
 
-constexpr size_t command_parameter_limit{10}; /**< maximum command parameters */
+constexpr size_t command_parameter_limit{16}; /**< maximum command parameters, including those of a stored command */
+constexpr size_t batch_response_limit{176};   /**< characters of collected responses in a batch response frame */
+constexpr char batch_marker[]{"Batch\n"};     /**< first line of a batch of newline separated commands */
 
-class CommandProcessor final
+class CommandProcessor final : public ResponseCollector
 {
 public:
     bool check_for_command();
+    bool check_stored_commands();
     String get_sequence();
+    bool collecting_responses() const;
+    bool collect_response(const String &content) override;
+    StoredCommands &get_stored_commands();
+    CommandLatency &get_command_latency();
+    const char *get_command_name(const size_t index) const;
+    size_t get_command_count() const;
 
 private:
-    Command *get_command(const String &buffer);
-    bool validate_signature(const String &buffer);
-    bool parse_parameters(const String &command_string, String command_tokens[], size_t &token_count);
+    bool process_frame(const Frame &frame);
+    bool process_batch(char *commands, const size_t length);
+    bool execute_command(char *buffer, const size_t length);
+    bool execute_stored_command(StoredCommands::Entry &entry);
+    void send_batch_responses(const String &header);
+    Command *get_command(char *buffer, const size_t length);
+    bool validate_signature(const Frame &frame);
+    bool parse_parameters(char *command, const size_t length, CommandToken command_tokens[], size_t &token_count);
     long m_command_sequence{1};
     CommandWarehouse command_warehouse{};
     long m_successful_commands{0};
     long m_failed_commands{0};
+
+    /**
+     * @brief Destination of command responses
+     *
+     */
+
+    enum class Collection
+    {
+        none,   /**< responses sent */
+        batch,  /**< responses collected for the batch response */
+        stored, /**< responses collected for the stored command result */
+    };
+
+    Collection m_collection{Collection::none};          // responses are collected rather than sent
+    char m_collected_responses[batch_response_limit]{}; // collected responses, each preceded by a space
+    size_t m_collected_length{0};                       // characters in collected responses
+    StoredCommands m_stored_commands{};                 // time tagged commands awaiting execution
+    CommandLatency m_latency{};                         // processing time histograms for each command
+    uint32_t m_verify_time{0};                          // verification time to record with the next command
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat command tokens
+ *
+ * This file implements the tokenizer which splits a command in place
+ *
+ */
+
+#include "CommandToken.h"
+
+/**
+ * @brief Split a command into tokens separated by white space
+ *
+ * @param[in,out] text command text, separators are replaced with terminators
+ * @param length characters in text
+ * @param[out] tokens tokens referring to the command text
+ * @param limit capacity of tokens
+ * @param[out] token_count number of tokens
+ * @return true successful
+ * @return false more than limit tokens
+ *
+ */
+
+bool tokenize(char *text, const size_t length, CommandToken tokens[], const size_t limit, size_t &token_count)
+{
+    size_t token_index{0};
+    size_t index{0};
+    while (true)
+    {
+        while (index < length && isspace(text[index]))
+        {
+            text[index++] = '\0';
+        }
+        if (index >= length)
+        {
+            break;
+        }
+        if (token_index >= limit)
+        {
+            return false;
+        }
+        auto token_start{index};
+        while (index < length && !isspace(text[index]))
+        {
+            ++index;
+        }
+        tokens[token_index++] = CommandToken{text + token_start, index - token_start};
+        if (index < length)
+        {
+            text[index++] = '\0';
+        }
+    }
+    token_count = token_index;
+    return true;
+}
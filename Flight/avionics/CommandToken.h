@@ -0,0 +1,61 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat command tokens
+ *
+ * This file declares the view of a command name or argument within a received frame
+ * and the tokenizer which produces it. Tokens refer to the frame and remain valid
+ * until the frame is released.
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+/**
+ * @brief Command name or argument
+ *
+ * The tokenizer terminates each token in place, so the text may be used as a C string
+ *
+ */
+
+class CommandToken final
+{
+public:
+    CommandToken() = default;
+    CommandToken(const char *text, const size_t length) : m_text{text}, m_length{length} {}
+
+    /**
+     * @brief Token text, zero terminated
+     *
+     */
+
+    const char *c_str() const { return m_text; }
+
+    /**
+     * @brief Characters in token
+     *
+     */
+
+    size_t length() const { return m_length; }
+
+    /**
+     * @brief Character at index
+     *
+     */
+
+    char operator[](const size_t index) const { return m_text[index]; }
+
+    /**
+     * @brief Token value as an integer
+     *
+     */
+
+    long to_long() const { return atol(m_text); }
+
+private:
+    const char *m_text{""};
+    size_t m_length{0};
+};
+
+bool tokenize(char *text, const size_t length, CommandToken tokens[], const size_t limit, size_t &token_count);
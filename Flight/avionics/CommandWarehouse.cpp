@@ -10,57 +10,59 @@
 #include "CommandWarehouse.h"
 #include "Commands.h"
 #include "log_utility.h"
+#include "CommandLatency.h"
+#include "SortedNames.h"
 
-CommandSetClock CommandWarehouse::m_set_clock{DateTime(0, 0, 0, 0, 0, 0)};
-CommandBeaconSp CommandWarehouse::m_beacon_sp{0};
-CommandPicTimes CommandWarehouse::m_pic_times{DateTime(0, 0, 0, 0, 0, 0)};
-CommandSSDVTimes CommandWarehouse::m_SSDV_times{DateTime(0, 0, 0, 0, 0, 0)};
-CommandClearPayloadQueue CommandWarehouse::m_clear_payload_queue{};
-CommandReportT CommandWarehouse::m_report_t{};
-CommandGetPayloadQueue CommandWarehouse::m_get_payload_queue{};
-CommandGetTelemetry CommandWarehouse::m_get_telemetry{};
-CommandGetPower CommandWarehouse::m_get_power{};
-CommandGetComms CommandWarehouse::m_get_comms{};
-CommandGetBeaconInterval CommandWarehouse::m_get_beacon_interval{};
-CommandPayComms CommandWarehouse::m_pay_comms{};
-CommandTweeSlee CommandWarehouse::m_twee_slee{};
-CommandWatchdog CommandWarehouse::m_watchdog{};
-CommandInvalid CommandWarehouse::m_command_invalid{};
-CommandUnknown CommandWarehouse::m_command_unknown{};
-CommandNoOperate CommandWarehouse::m_no_operate{};
-CommandSendTestPacket CommandWarehouse::m_send_test_packet{};
-CommandUnsetClock CommandWarehouse::m_unset_clock{};
-CommandLogArguments CommandWarehouse::m_log_arguments{""};
-CommandBackgroundRSSI CommandWarehouse::m_background_RSSI{"00"};
-CommandCurrentRSSI CommandWarehouse::m_current_RSSI{};
-CommandModifyCCA CommandWarehouse::m_modify_CCA{"000"};
-
-CommandWarehouse::CommandMap CommandWarehouse::command_description[]{
-    {"SetClock", &m_set_clock},
-    {"BeaconSp", &m_beacon_sp},
-    {"PicTimes", &m_pic_times},
-    {"SSDVTimes", &m_SSDV_times},
-    {"ClearPayloadQueue", &m_clear_payload_queue},
-    {"ReportT", &m_report_t},
-    {"GetPayloadQueue", &m_get_payload_queue},
-    {"GetTelemetry", &m_get_telemetry},
-    {"GetPower", &m_get_power},
-    {"GetComms", &m_get_comms},
-    {"GetBeaconInterval", &m_get_beacon_interval},
-    {"PayComms", &m_pay_comms},
-    {"TweeSlee", &m_twee_slee},
-    {"Watchdog", &m_watchdog},
-    {"Invalid", &m_command_invalid},
-    {"Unknown", &m_command_unknown},
-    {"NoOperate", &m_no_operate},
-    {"SendTestPacket", &m_send_test_packet},
-    {"UnsetClock", &m_unset_clock},
-    {"LogArguments", &m_log_arguments},
-    {"BackgroundRSSI", &m_background_RSSI},
-    {"CurrentRSSI", &m_current_RSSI},
-    {"ModifyCCA", &m_modify_CCA}
+// Command descriptors in ascending order of name, checked at compile time
+
+constexpr CommandWarehouse::CommandMap CommandWarehouse::command_description[]{
+    entry<CommandBackgroundRSSI>("BackgroundRSSI"),
+    entry<CommandBeaconSp>("BeaconSp"),
+    entry<CommandClearCommandLatency>("ClearCommandLatency"),
+    entry<CommandClearPayloadQueue>("ClearPayloadQueue"),
+    entry<CommandClearProfile>("ClearProfile"),
+    entry<CommandClearStoredCommands>("ClearStoredCommands"),
+    entry<CommandClearStoredResults>("ClearStoredResults"),
+    entry<CommandCurrentRSSI>("CurrentRSSI"),
+    entry<CommandGetBeaconInterval>("GetBeaconInterval"),
+    entry<CommandGetBootTimeline>("GetBootTimeline"),
+    entry<CommandGetCommandLatency>("GetCommandLatency"),
+    entry<CommandGetComms>("GetComms"),
+    entry<CommandGetDutyCycle>("GetDutyCycle"),
+    entry<CommandGetLinkStats>("GetLinkStats"),
+    entry<CommandGetPayloadQueue>("GetPayloadQueue"),
+    entry<CommandGetPower>("GetPower"),
+    entry<CommandGetProfile>("GetProfile"),
+    entry<CommandGetStoredCommands>("GetStoredCommands"),
+    entry<CommandGetStoredResults>("GetStoredResults"),
+    entry<CommandGetTaskStats>("GetTaskStats"),
+    entry<CommandGetTelemetry>("GetTelemetry"),
+    entry<CommandInvalid>("Invalid"),
+    entry<CommandLogArguments>("LogArguments"),
+    entry<CommandModifyBaud>("ModifyBaud"),
+    entry<CommandModifyCCA>("ModifyCCA"),
+    entry<CommandNoOperate>("NoOperate"),
+    entry<CommandPayComms>("PayComms"),
+    entry<CommandPicTimes>("PicTimes"),
+    entry<CommandReportT>("ReportT"),
+    entry<CommandSSDVTimes>("SSDVTimes"),
+    entry<CommandSendTestPacket>("SendTestPacket"),
+    entry<CommandSetClock>("SetClock"),
+    entry<CommandStoreCommand>("StoreCommand"),
+    entry<CommandTweeSlee>("TweeSlee"),
+    entry<CommandUnknown>("Unknown"),
+    entry<CommandUnsetClock>("UnsetClock"),
+    entry<CommandWatchdog>("Watchdog"),
 };
 
+// Only the command being processed occupies RAM
+
+alignas(CommandWarehouse::largest(CommandWarehouse::command_description, sizeof(CommandWarehouse::command_description) / sizeof(CommandWarehouse::command_description[0]),
+                                  &CommandWarehouse::CommandMap::alignment))
+unsigned char CommandWarehouse::m_storage[largest(command_description, sizeof(command_description) / sizeof(command_description[0]), &CommandMap::size)]{};
+Command *CommandWarehouse::m_command{nullptr};
+size_t CommandWarehouse::m_retrieved{0};
+
 /**
  * @brief Return a command object
  *
@@ -68,24 +70,87 @@ CommandWarehouse::CommandMap CommandWarehouse::command_description[]{
  * @param token_count number of tokens including command
  * @return Command* command object to be executed
  *
+ * The command names are sorted, so the command is found by binary search. The command
+ * object is constructed in the shared storage and remains valid until the next call.
+ * A command whose arguments fail validation or cannot be loaded is Invalid.
+ *
  */
 
-Command *CommandWarehouse::RetrieveCommand(const String tokens[], const size_t token_count)
+Command *CommandWarehouse::RetrieveCommand(const CommandToken tokens[], const size_t token_count)
 {
-    for (const auto &entry : command_description)
+    constexpr size_t count{sizeof(command_description) / sizeof(command_description[0])};
+    static_assert(sorted(command_description, count), "Command names must be unique and in ascending order");
+    constexpr size_t invalid{position(command_description, count, "Invalid")};
+    constexpr size_t unknown{position(command_description, count, "Unknown")};
+    static_assert(invalid < count && unknown < count, "Invalid and Unknown commands must be described");
+
+    auto index{find_name(command_description, count, tokens[0].c_str(), &CommandMap::command_name)};
+    if (index == count)
     {
-        if (tokens[0] == entry.command_name)
-        {
-            if (entry.command_pointer->validate_arguments(tokens, token_count))
-            {
-                entry.command_pointer->load_data(tokens, token_count);
-                return entry.command_pointer;
-            }
-            else
-            {
-                return &m_command_invalid;
-            }
-        }
+        return construct_command(unknown);
     }
-    return &m_command_unknown;
+    auto command{construct_command(index)};
+    if (command->validate_arguments(tokens, token_count) && command->load_data(tokens, token_count))
+    {
+        return command;
+    }
+    return construct_command(invalid);
+}
+
+/**
+ * @brief Construct a command in the shared storage
+ *
+ * @param index position in the command table
+ * @return Command* command object
+ *
+ * The previous command is destroyed, so only one command object exists at a time
+ *
+ */
+
+Command *CommandWarehouse::construct_command(const size_t index)
+{
+    if (m_command != nullptr)
+    {
+        m_command->~Command();
+    }
+    m_command = command_description[index].construct(m_storage);
+    m_retrieved = index;
+    return m_command;
+}
+
+/**
+ * @brief Return the index of the command most recently retrieved
+ *
+ * @return size_t position in the command table
+ *
+ */
+
+size_t CommandWarehouse::RetrievedIndex() const
+{
+    return m_retrieved;
+}
+
+/**
+ * @brief Return the name of a command
+ *
+ * @param index position in the command table, less than CommandCount()
+ * @return const char* command name
+ *
+ */
+
+const char *CommandWarehouse::CommandName(const size_t index) const
+{
+    return command_description[index].command_name;
+}
+
+/**
+ * @brief Return the number of commands
+ *
+ */
+
+size_t CommandWarehouse::CommandCount() const
+{
+    static_assert(sizeof(command_description) / sizeof(command_description[0]) == warehouse_command_count,
+                  "warehouse_command_count must match the command table");
+    return sizeof(command_description) / sizeof(command_description[0]);
 }
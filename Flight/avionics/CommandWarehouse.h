@@ -8,6 +8,9 @@
 #pragma once
 
 #include "Commands.h"
+#include <new>
+
+constexpr size_t warehouse_command_count{37}; /**< commands in the command table @hideinitializer */
 
 /**
  * @brief Warehouse for Command objects
@@ -17,37 +20,106 @@
 class CommandWarehouse final
 {
 public:
-    Command *RetrieveCommand(const String tokens[], const size_t token_count);
+    Command *RetrieveCommand(const CommandToken tokens[], const size_t token_count);
+    size_t RetrievedIndex() const;
+    const char *CommandName(const size_t index) const;
+    size_t CommandCount() const;
 
 private:
-    static CommandSetClock m_set_clock;
-    static CommandBeaconSp m_beacon_sp;
-    static CommandPicTimes m_pic_times;
-    static CommandSSDVTimes m_SSDV_times;
-    static CommandClearPayloadQueue m_clear_payload_queue;
-    static CommandReportT m_report_t;
-    static CommandGetPayloadQueue m_get_payload_queue;
-    static CommandGetTelemetry m_get_telemetry;
-    static CommandGetPower m_get_power;
-    static CommandGetComms m_get_comms;
-    static CommandGetBeaconInterval m_get_beacon_interval;
-    static CommandPayComms m_pay_comms;
-    static CommandTweeSlee m_twee_slee;
-    static CommandWatchdog m_watchdog;
-    static CommandInvalid m_command_invalid;
-    static CommandUnknown m_command_unknown;
-    static CommandNoOperate m_no_operate;
-    static CommandSendTestPacket m_send_test_packet;
-    static CommandUnsetClock m_unset_clock;
-    static CommandLogArguments m_log_arguments;
-    static CommandBackgroundRSSI m_background_RSSI;
-    static CommandCurrentRSSI m_current_RSSI;
-    static CommandModifyCCA m_modify_CCA;
+    /**
+     * @brief Command descriptor, kept in flash
+     *
+     */
+
     struct CommandMap
     {
-        const String command_name;
-        Command *const command_pointer;
+        const char *command_name;             /**< name used in ground commands */
+        Command *(*construct)(void *storage); /**< construct the command in the shared storage */
+        size_t size;                          /**< storage required by the command */
+        size_t alignment;                     /**< alignment required by the command */
     };
 
-    static CommandMap command_description[];
-};
\ No newline at end of file
+    static const CommandMap command_description[]; /**< sorted by command name */
+    static unsigned char m_storage[];              /**< storage for the command being processed, sized for the largest command */
+    static Command *m_command;                     /**< command constructed in the storage */
+    static size_t m_retrieved;                     /**< index of the command constructed in the storage */
+
+    Command *construct_command(const size_t index);
+
+    /**
+     * @brief Construct a command in the shared storage
+     *
+     * @tparam T command class
+     *
+     */
+
+    template <typename T>
+    static Command *construct(void *storage)
+    {
+        return new (storage) T{};
+    }
+
+    /**
+     * @brief Build a command descriptor
+     *
+     * @tparam T command class
+     *
+     */
+
+    template <typename T>
+    static constexpr CommandMap entry(const char *name)
+    {
+        return CommandMap{name, &construct<T>, sizeof(T), alignof(T)};
+    }
+
+    /**
+     * @brief Compare command names at compile time
+     *
+     * @return true first name sorts before second
+     *
+     */
+
+    static constexpr bool precedes(const char *first, const char *second)
+    {
+        return *first == *second ? (*first != '\0' && precedes(first + 1, second + 1))
+                                 : static_cast<unsigned char>(*first) < static_cast<unsigned char>(*second);
+    }
+
+    /**
+     * @brief Check the command table order at compile time
+     *
+     * @return true names unique and in ascending order
+     *
+     */
+
+    static constexpr bool sorted(const CommandMap *entries, const size_t count)
+    {
+        return count < 2 || (precedes(entries[0].command_name, entries[1].command_name) && sorted(entries + 1, count - 1));
+    }
+
+    /**
+     * @brief Find a command in the table at compile time
+     *
+     * @return size_t index of the command, count if not found
+     *
+     */
+
+    static constexpr size_t position(const CommandMap *entries, const size_t count, const char *name, const size_t index = 0)
+    {
+        return index >= count || (!precedes(entries[index].command_name, name) && !precedes(name, entries[index].command_name))
+                   ? index
+                   : position(entries, count, name, index + 1);
+    }
+
+    /**
+     * @brief Find the largest size or alignment in the table at compile time
+     *
+     * @return size_t largest value of the field
+     *
+     */
+
+    static constexpr size_t largest(const CommandMap *entries, const size_t count, size_t CommandMap::*field, const size_t value = 0)
+    {
+        return count == 0 ? value : largest(entries + 1, count - 1, field, entries[0].*field > value ? entries[0].*field : value);
+    }
+};
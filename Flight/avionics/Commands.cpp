@@ -17,15 +17,28 @@
  * SPT: PicTimes: set times for photos
  * SST: SSDVTimes: set times for SSDV broadcasts
  * CPQ: ClearPayloadQueue: empty payload activity queue
+ * STC: StoreCommand: store a command for execution at a time
+ * CSC: ClearStoredCommands: empty stored command store
+ * CSR: ClearStoredResults: discard results of executed stored commands after downlink
+ * CCL: ClearCommandLatency: reset command latency histograms
+ * CPF: ClearProfile: reset process loop profile and free memory low water mark
  *
  * Get satellite state:
  *
  * GRC: ReportT: subsumes GetTime: reply with realtime clock setting
- * GPQ: GetPayloadQueue: reply with payload schedule
+ * GPQ: GetPayloadQueue: reply with payload schedule, packed into as few frames as fit
  * GTY: GetTelemetry: reply with telemetry
  * GPW: GetPower: reply with power status
  * GRS: GetComms: reply with Radio Board status
  * GBI: GetBeaconInterval: reply with beacon interval
+ * GLS: GetLinkStats: reply with Radio Board link counters
+ * GSC: GetStoredCommands: reply with stored commands awaiting execution
+ * GSR: GetStoredResults: reply with results of executed stored commands
+ * GCL: GetCommandLatency: reply with command processing time histograms and stage maxima
+ * GTS: GetTaskStats: reply with process loop task runs, overruns, and worst latency
+ * GPF: GetProfile: reply with free memory low water mark and process loop stage times
+ * GDC: GetDutyCycle: reply with process loop time busy and idle since the previous GetDutyCycle
+ * GBT: GetBootTimeline: reply with the time each boot phase was reached
  *
  * Invoke satellite operation:
  *
@@ -47,6 +60,7 @@
  * RBR: BackgroundRSSI: radio background RSSI
  * RCR: CurrentRSSI: radio current RSSI
  * RMC: ModifyCCA: Modify CCA threshold
+ * RMB: ModifyBaud: Modify Radio Board serial link speed
  *
  * Deprecated commands:
  *
@@ -74,14 +88,24 @@
 #include "AvionicsBoard.h"
 #include "PowerBoard.h"
 #include "PayloadBoard.h"
+#include "RadioBoard.h"
 #include "CommandProcessor.h"
+#include "ResponsePacker.h"
+#include "DateTimeParser.h"
+#include "TaskScheduler.h"
+#include "Profiler.h"
+#include "IdleManager.h"
+#include "Startup.h"
+
+constexpr size_t payload_record_limit{48}; /**< characters in a payload queue record, including the terminator @hideinitializer */
+constexpr size_t task_record_limit{56};    /**< characters in a task statistics record, including the terminator @hideinitializer */
 
 /**
  * @brief Helper function to determine if a string is numeric
  *
  */
 
-bool is_numeric(const String &str)
+bool is_numeric(const CommandToken &str)
 {
     for (auto i{0}; i < str.length(); i++)
     {
@@ -94,54 +118,44 @@ bool is_numeric(const String &str)
 }
 
 /**
- * @brief Helper function to validate a date
+ * @brief Helper function to parse a date and time argument
+ *
+ * @param tokens command tokens
+ * @param token_count number of tokens
+ * @param first index of the first date and time token
+ * @param[out] time parsed date and time
+ * @param[out] consumed number of tokens used
+ * @return true valid date and time within the mission years
+ * @return false error
  *
  */
 
-bool is_valid_time(const String tokens[], const size_t token_count)
+bool parse_time(const CommandToken tokens[], const size_t token_count, const size_t first, DateTime &time, size_t &consumed)
 {
-    if (token_count != 7)
-    {
-        return false;
-    }
-    if (!is_numeric(tokens[1]) || !is_numeric(tokens[2]) || !is_numeric(tokens[3]) || !is_numeric(tokens[4]) || !is_numeric(tokens[5]) || !is_numeric(tokens[6]))
-    {
-        return false;
-    }
-    long year = tokens[1].toInt();
-    if (year < minimum_valid_year || year > maximum_valid_year)
-    {
-        return false;
-    }
-    long month = tokens[2].toInt();
-    if (month < 1 || month > 12)
+    auto error{parse_date_time(tokens, token_count, first, time, consumed)};
+    if (error == DateTimeError::none && (time.year() < minimum_valid_year || time.year() > maximum_valid_year))
     {
-        return false;
-    }
-    // todo: add check for valid days in month
-    long day = tokens[3].toInt();
-    if (day < 1 || day > 31)
-    {
-        return false;
+        error = DateTimeError::year;
     }
-    long hour = tokens[4].toInt();
-    if (hour < 0 || hour > 23)
-    {
-        return false;
-    }
-    long minute = tokens[5].toInt();
-    if (minute < 0 || minute > 59)
-    {
-        return false;
-    }
-    long second = tokens[6].toInt();
-    if (second < 0 || second > 59)
+    if (error != DateTimeError::none)
     {
+        Log.errorln("Time argument: %s", date_time_error_name(error));
         return false;
     }
     return true;
 }
 
+/**
+ * @brief Helper function to parse a date and time which is the only argument
+ *
+ */
+
+bool parse_time(const CommandToken tokens[], const size_t token_count, DateTime &time)
+{
+    size_t consumed{0};
+    return parse_time(tokens, token_count, 1, time, consumed) && 1 + consumed == token_count;
+}
+
 /**
  * @brief Validate the arguments
  *
@@ -152,7 +166,7 @@ bool is_valid_time(const String tokens[], const size_t token_count)
  *
  */
 
-bool Command::validate_arguments(const String tokens[], const size_t token_count) const
+bool Command::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
     if (token_count < 2)
@@ -172,7 +186,7 @@ bool Command::validate_arguments(const String tokens[], const size_t token_count
  *
  */
 
-bool Command::load_data(const String tokens[], const size_t token_count)
+bool Command::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("No data to load for: %s", tokens[0].c_str());
     return true;
@@ -192,6 +206,10 @@ bool Command::acknowledge_receipt() const
 {
     Log.traceln("Acknowledging command");
     extern CommandProcessor command_processor;
+    if (command_processor.collecting_responses())
+    {
+        return true; // batch acknowledged once, stored commands not acknowledged
+    }
     Message message{Message::acknowledgement, ACK + " " + command_processor.get_sequence()};
     return message.send();
 }
@@ -210,6 +228,10 @@ bool Command::negative_acknowledge_receipt() const
 {
     Log.traceln("Negative acknowledging command");
     extern CommandProcessor command_processor;
+    if (command_processor.collecting_responses())
+    {
+        return true; // failure reported in batch response or stored command result
+    }
     Message message{Message::negative_acknowledgement, NACK + " " + command_processor.get_sequence()};
     return message.send();
 }
@@ -238,10 +260,10 @@ bool Command::execute() const
  *
  */
 
-bool CommandSetClock::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandSetClock::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
-    return is_valid_time(tokens, token_count);
+    return token_count > 1; // the date and time are checked as load_data parses them
 }
 
 /**
@@ -252,18 +274,10 @@ bool CommandSetClock::validate_arguments(const String tokens[], const size_t tok
  *
  */
 
-bool CommandSetClock::load_data(const String tokens[], const size_t token_count)
+bool CommandSetClock::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading arguments for: %s", tokens[0].c_str());
-    uint16_t year = static_cast<uint16_t>(tokens[1].toInt());
-    uint8_t month = static_cast<uint8_t>(tokens[2].toInt());
-    uint8_t day = static_cast<uint8_t>(tokens[3].toInt());
-    uint8_t hour = static_cast<uint8_t>(tokens[4].toInt());
-    uint8_t minute = static_cast<uint8_t>(tokens[5].toInt());
-    uint8_t second = static_cast<uint8_t>(tokens[6].toInt());
-
-    m_time = DateTime{year, month, day, hour, minute, second};
-    return true;
+    return parse_time(tokens, token_count, m_time);
 }
 
 /**
@@ -306,7 +320,7 @@ bool CommandSetClock::execute() const
  *
  */
 
-bool CommandBeaconSp::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandBeaconSp::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
     if (token_count != 2)
@@ -317,7 +331,7 @@ bool CommandBeaconSp::validate_arguments(const String tokens[], const size_t tok
     {
         return false;
     }
-    long seconds = tokens[1].toInt();
+    long seconds = tokens[1].to_long();
     if (seconds == 0)
     {
         return true; // zero turns off the beacon
@@ -337,10 +351,10 @@ bool CommandBeaconSp::validate_arguments(const String tokens[], const size_t tok
  *
  */
 
-bool CommandBeaconSp::load_data(const String tokens[], const size_t token_count)
+bool CommandBeaconSp::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading argument for: %s", tokens[0].c_str());
-    m_seconds = tokens[1].toInt();
+    m_seconds = tokens[1].to_long();
     return true;
 }
 
@@ -382,10 +396,10 @@ bool CommandBeaconSp::execute() const
  * @return false error
  */
 
-bool CommandPicTimes::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandPicTimes::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
-    return is_valid_time(tokens, token_count);
+    return token_count > 1; // the date and time are checked as load_data parses them
 }
 
 /**
@@ -395,18 +409,10 @@ bool CommandPicTimes::validate_arguments(const String tokens[], const size_t tok
  * @return false error
  */
 
-bool CommandPicTimes::load_data(const String tokens[], const size_t token_count)
+bool CommandPicTimes::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading arguments for: %s", tokens[0].c_str());
-    uint16_t year = static_cast<uint16_t>(tokens[1].toInt());
-    uint8_t month = static_cast<uint8_t>(tokens[2].toInt());
-    uint8_t day = static_cast<uint8_t>(tokens[3].toInt());
-    uint8_t hour = static_cast<uint8_t>(tokens[4].toInt());
-    uint8_t minute = static_cast<uint8_t>(tokens[5].toInt());
-    uint8_t second = static_cast<uint8_t>(tokens[6].toInt());
-
-    m_time = DateTime{year, month, day, hour, minute, second};
-    return true;
+    return parse_time(tokens, token_count, m_time);
 }
 
 /**
@@ -448,10 +454,10 @@ bool CommandPicTimes::execute() const
  * @return false error
  */
 
-bool CommandSSDVTimes::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandSSDVTimes::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
-    return is_valid_time(tokens, token_count);
+    return token_count > 1; // the date and time are checked as load_data parses them
 }
 
 /**
@@ -461,18 +467,10 @@ bool CommandSSDVTimes::validate_arguments(const String tokens[], const size_t to
  * @return false error
  */
 
-bool CommandSSDVTimes::load_data(const String tokens[], const size_t token_count)
+bool CommandSSDVTimes::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading arguments for: %s", tokens[0].c_str());
-    uint16_t year = static_cast<uint16_t>(tokens[1].toInt());
-    uint8_t month = static_cast<uint8_t>(tokens[2].toInt());
-    uint8_t day = static_cast<uint8_t>(tokens[3].toInt());
-    uint8_t hour = static_cast<uint8_t>(tokens[4].toInt());
-    uint8_t minute = static_cast<uint8_t>(tokens[5].toInt());
-    uint8_t second = static_cast<uint8_t>(tokens[6].toInt());
-
-    m_time = DateTime{year, month, day, hour, minute, second};
-    return true;
+    return parse_time(tokens, token_count, m_time);
 }
 
 /**
@@ -571,6 +569,40 @@ bool CommandReportT::execute() const
     return response.send() && status;
 }
 
+/**
+ * @brief Validate arguments for GetPayloadQueue command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * An optional Compact argument selects hexadecimal seconds since 1970 for the entry times
+ *
+ */
+
+bool CommandGetPayloadQueue::validate_arguments(const CommandToken tokens[], const size_t token_count) const
+{
+    Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
+    if (token_count == 1)
+    {
+        return true;
+    }
+    return token_count == 2 && strcmp(tokens[1].c_str(), "Compact") == 0;
+}
+
+/**
+ * @brief Load data for GetPayloadQueue command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetPayloadQueue::load_data(const CommandToken tokens[], const size_t token_count)
+{
+    Log.traceln("Loading argument for: %s", tokens[0].c_str());
+    m_compact = token_count == 2;
+    return true;
+}
+
 /**
  * @brief Acknowledge GetPayloadQueue command
  *
@@ -596,16 +628,26 @@ bool CommandGetPayloadQueue::execute() const
 {
     auto status{Command::execute()};
     Log.verboseln("GetPayloadQueue");
+    if (!status)
+    {
+        auto response{Response{"ERR"}};
+        return response.send() && status;
+    }
     extern AvionicsBoard avionics;
-    auto response{Response{status ? ("GPQ " + String{avionics.get_payload_queue_size()} + " entries in queue") : "ERR"}};
-    status = response.send() && status;
-    for (auto i{0}; i < avionics.get_payload_queue_size(); i++)
+    ResponsePacker packer{"GPQ"};
+    char record[payload_record_limit]{};
+    auto size{avionics.get_payload_queue_size()};
+    auto length{snprintf(record, sizeof(record), "%u", static_cast<unsigned>(size))};
+    packer.add(record, static_cast<size_t>(length));
+    for (size_t index{0}; index < size; ++index)
     {
-        String element = String{i} + " " + avionics.m_payload_queue[i].time.timestamp() + " " + PayloadQueue::activity_name(avionics.m_payload_queue[i].type);
-        auto response{Response{status ? ("GPQ " + element) : "ERR"}};
-        status = response.send() && status;
+        auto &element{avionics.m_payload_queue[index]};
+        length = snprintf(record, sizeof(record), "%u ", static_cast<unsigned>(index));
+        length += ResponsePacker::format_time(element.time, m_compact, record + length);
+        length += snprintf(record + length, sizeof(record) - length, " %s", PayloadQueue::activity_name(element.type).c_str());
+        packer.add(record, static_cast<size_t>(length));
     }
-    return status;
+    return packer.finish() && status;
 }
 
 /**
@@ -698,6 +740,36 @@ bool CommandGetComms::execute() const
     return message.send() && status;
 }
 
+/**
+ * @brief Acknowledge GetLinkStats command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetLinkStats::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetLinkStats");
+    return status;
+}
+
+/**
+ * @brief  Execute GetLinkStats command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetLinkStats::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetLinkStats");
+    extern RadioBoard radio;
+    auto response{Response{status ? ("GLS" + radio.get_link_detail()) : "ERR"}};
+    return response.send() && status;
+}
+
 /**
  * @brief Acknowledge GetBeaconInterval command
  *
@@ -974,7 +1046,7 @@ bool CommandUnsetClock::execute() const
  *
  */
 
-bool CommandLogArguments::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandLogArguments::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("%d arguments for: %s", token_count - 1, tokens[0].c_str());
     return true;
@@ -990,13 +1062,14 @@ bool CommandLogArguments::validate_arguments(const String tokens[], const size_t
  *
  */
 
-bool CommandLogArguments::load_data(const String tokens[], const size_t token_count)
+bool CommandLogArguments::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading argument(s) for: %s", tokens[0].c_str());
     m_arguments = "";
     for (auto i{1}; i < token_count; ++i)
     {
-        m_arguments += tokens[i] + " ";
+        m_arguments += tokens[i].c_str();
+        m_arguments += " ";
     }
     return true;
 }
@@ -1038,7 +1111,7 @@ bool CommandLogArguments::execute() const
  *
  */
 
-bool CommandBackgroundRSSI::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandBackgroundRSSI::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
     if (token_count != 2)
@@ -1049,7 +1122,7 @@ bool CommandBackgroundRSSI::validate_arguments(const String tokens[], const size
     {
         return false;
     }
-    long seconds = tokens[1].toInt();
+    long seconds = tokens[1].to_long();
     if (seconds < minimum_background_rssi_interval || seconds > maximum_background_rssi_interval)
     {
         return false;
@@ -1065,10 +1138,10 @@ bool CommandBackgroundRSSI::validate_arguments(const String tokens[], const size
  *
  */
 
-bool CommandBackgroundRSSI::load_data(const String tokens[], const size_t token_count)
+bool CommandBackgroundRSSI::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading argument for: %s", tokens[0].c_str());
-    m_seconds = tokens[1];
+    m_seconds = tokens[1].c_str();
     return true;
 }
 
@@ -1142,7 +1215,7 @@ bool CommandCurrentRSSI::execute() const
  *
  */
 
-bool CommandModifyCCA::validate_arguments(const String tokens[], const size_t token_count) const
+bool CommandModifyCCA::validate_arguments(const CommandToken tokens[], const size_t token_count) const
 {
     Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
     if (token_count != 2)
@@ -1164,10 +1237,10 @@ bool CommandModifyCCA::validate_arguments(const String tokens[], const size_t to
  *
  */
 
-bool CommandModifyCCA::load_data(const String tokens[], const size_t token_count)
+bool CommandModifyCCA::load_data(const CommandToken tokens[], const size_t token_count)
 {
     Log.traceln("Loading argument for: %s", tokens[0].c_str());
-    m_threshold = tokens[1];
+    m_threshold = tokens[1].c_str();
     return true;
 }
 
@@ -1201,4 +1274,616 @@ bool CommandModifyCCA::execute() const
     Log.traceln("Requesting CCA threshold %s", m_threshold.c_str());
     Message message(Message::modify_cca, m_threshold);
     return message.send() && status;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Validate arguments for ModifyBaud command
+ *
+ * @return true successful
+ * @return false error
+ *
+ */
+
+bool CommandModifyBaud::validate_arguments(const CommandToken tokens[], const size_t token_count) const
+{
+    Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
+    if (token_count != 2)
+    {
+        return false;
+    }
+    if (!is_numeric(tokens[1]))
+    {
+        return false;
+    }
+    return RadioBoard::supported_baud_rate(static_cast<uint32_t>(tokens[1].to_long()));
+}
+
+/**
+ * @brief Load argument for ModifyBaud command
+ *
+ * @return true successful
+ * @return false error
+ *
+ */
+
+bool CommandModifyBaud::load_data(const CommandToken tokens[], const size_t token_count)
+{
+    Log.traceln("Loading argument for: %s", tokens[0].c_str());
+    m_baud_rate = static_cast<uint32_t>(tokens[1].to_long());
+    return true;
+}
+
+/**
+ * @brief Acknowledge ModifyBaud command
+ *
+ * @return true successful
+ * @return false error
+ *
+ */
+
+bool CommandModifyBaud::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("ModifyBaud: %l", m_baud_rate);
+    return status;
+}
+
+/**
+ * @brief Execute ModifyBaud command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The response is sent at the current speed before negotiation starts
+ *
+ */
+
+bool CommandModifyBaud::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("ModifyBaud");
+    auto response{Response{status ? "RMB" : "ERR"}};
+    status = response.send() && status;
+    extern RadioBoard radio;
+    return radio.propose_baud_rate(m_baud_rate) && status;
+}
+
+/**
+ * @brief Validate arguments for StoreCommand command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The execution time in any form accepted by PicTimes is followed by the command and its
+ * arguments, which are checked as load_data parses them
+ *
+ */
+
+bool CommandStoreCommand::validate_arguments(const CommandToken tokens[], const size_t token_count) const
+{
+    Log.traceln("Validating %d argument(s) for: %s", token_count - 1, tokens[0].c_str());
+    return token_count > 2;
+}
+
+/**
+ * @brief Load data for StoreCommand command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandStoreCommand::load_data(const CommandToken tokens[], const size_t token_count)
+{
+    Log.traceln("Loading arguments for: %s", tokens[0].c_str());
+    size_t consumed{0};
+    if (!parse_time(tokens, token_count, 1, m_time, consumed) || 1 + consumed >= token_count)
+    {
+        return false;
+    }
+    auto command_token{1 + consumed};
+    size_t length{0};
+    for (auto index{command_token}; index < token_count; ++index)
+    {
+        length += tokens[index].length() + 1;
+    }
+    if (length > stored_command_length)
+    {
+        return false;
+    }
+    m_length = 0;
+    for (auto index{command_token}; index < token_count; ++index)
+    {
+        if (m_length > 0)
+        {
+            m_command[m_length++] = ' ';
+        }
+        memcpy(m_command + m_length, tokens[index].c_str(), tokens[index].length());
+        m_length += tokens[index].length();
+    }
+    m_command[m_length] = '\0';
+    return true;
+}
+
+/**
+ * @brief Acknowledge StoreCommand command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandStoreCommand::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("StoreCommand: %s", m_command);
+    return status;
+}
+
+/**
+ * @brief Execute StoreCommand command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * Responds with the number of stored commands awaiting execution
+ *
+ */
+
+bool CommandStoreCommand::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("StoreCommand");
+    extern CommandProcessor command_processor;
+    auto &stored_commands{command_processor.get_stored_commands()};
+    status = stored_commands.store(m_time.unixtime(), m_command, m_length) && status;
+    auto response{Response{status ? "STC " + String{stored_commands.size()} : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetStoredCommands command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetStoredCommands::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetStoredCommands");
+    return status;
+}
+
+/**
+ * @brief Execute GetStoredCommands command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The first record is the number of stored commands, each following record is the
+ * execution time and the command
+ *
+ */
+
+bool CommandGetStoredCommands::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetStoredCommands");
+    extern CommandProcessor command_processor;
+    const auto &stored_commands{command_processor.get_stored_commands()};
+    ResponsePacker packer{"GSC"};
+    char record[packed_time_limit + stored_command_length]{};
+    auto length{snprintf(record, sizeof(record), "%u", static_cast<unsigned>(stored_commands.size()))};
+    packer.add(record, static_cast<size_t>(length));
+    for (size_t index{0}; index < stored_commands.size(); ++index)
+    {
+        const auto &entry{stored_commands[index]};
+        auto time_length{ResponsePacker::format_time(DateTime{entry.time}, false, record)};
+        length = snprintf(record + time_length, sizeof(record) - time_length, " %s", entry.text);
+        packer.add(record, time_length + static_cast<size_t>(length));
+    }
+    return packer.finish() && status;
+}
+
+/**
+ * @brief Acknowledge ClearStoredCommands command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearStoredCommands::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("ClearStoredCommands");
+    return status;
+}
+
+/**
+ * @brief Execute ClearStoredCommands command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearStoredCommands::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("ClearStoredCommands");
+    extern CommandProcessor command_processor;
+    command_processor.get_stored_commands().clear();
+    auto response{Response{status ? "CSC" : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetStoredResults command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetStoredResults::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetStoredResults");
+    return status;
+}
+
+/**
+ * @brief Execute GetStoredResults command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The first record is the number of results and the number replaced before downlink,
+ * each following record is the execution time, 1 for success or 0 for failure, the
+ * command name, and its responses. The results are kept until ClearStoredResults, so
+ * they survive a lost downlink.
+ *
+ */
+
+bool CommandGetStoredResults::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetStoredResults");
+    extern CommandProcessor command_processor;
+    auto &stored_commands{command_processor.get_stored_commands()};
+    ResponsePacker packer{"GSR"};
+    char record[packed_time_limit + stored_result_length + 4]{};
+    auto length{snprintf(record, sizeof(record), "%u %lu", static_cast<unsigned>(stored_commands.result_count()),
+                         static_cast<unsigned long>(stored_commands.results_lost()))};
+    packer.add(record, static_cast<size_t>(length));
+    for (size_t index{0}; index < stored_commands.result_count(); ++index)
+    {
+        const auto &result{stored_commands.result(index)};
+        auto time_length{ResponsePacker::format_time(DateTime{result.time}, false, record)};
+        length = snprintf(record + time_length, sizeof(record) - time_length, " %d %s", result.status ? 1 : 0, result.text);
+        packer.add(record, time_length + static_cast<size_t>(length));
+    }
+    return packer.finish() && status;
+}
+
+/**
+ * @brief Acknowledge ClearStoredResults command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearStoredResults::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("ClearStoredResults");
+    return status;
+}
+
+/**
+ * @brief Execute ClearStoredResults command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * Sent by the ground once GetStoredResults has been received
+ *
+ */
+
+bool CommandClearStoredResults::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("ClearStoredResults");
+    extern CommandProcessor command_processor;
+    command_processor.get_stored_commands().clear_results();
+    auto response{Response{status ? "CSR" : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetCommandLatency command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetCommandLatency::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetCommandLatency");
+    return status;
+}
+
+/**
+ * @brief Execute GetCommandLatency command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The first record is the number of commands with histograms. Each following record
+ * is the command name, its total time histogram, and its longest parse, verify,
+ * acknowledge, and execute times.
+ *
+ */
+
+bool CommandGetCommandLatency::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetCommandLatency");
+    extern CommandProcessor command_processor;
+    const auto &latency{command_processor.get_command_latency()};
+    size_t recorded{0};
+    for (size_t index{0}; index < command_processor.get_command_count(); ++index)
+    {
+        recorded += latency.recorded(index) ? 1 : 0;
+    }
+    ResponsePacker packer{"GCL"};
+    char record[radio_response_limit + 1]{};
+    auto length{snprintf(record, sizeof(record), "%u", static_cast<unsigned>(recorded))};
+    packer.add(record, static_cast<size_t>(length));
+    for (size_t index{0}; index < command_processor.get_command_count(); ++index)
+    {
+        if (latency.recorded(index))
+        {
+            auto name_length{static_cast<size_t>(snprintf(record, sizeof(record), "%s", command_processor.get_command_name(index)))};
+            auto histogram_length{latency.format(index, record + name_length, sizeof(record) - name_length)};
+            packer.add(record, name_length + histogram_length);
+        }
+    }
+    return packer.finish() && status;
+}
+
+/**
+ * @brief Acknowledge ClearCommandLatency command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearCommandLatency::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("ClearCommandLatency");
+    return status;
+}
+
+/**
+ * @brief Execute ClearCommandLatency command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearCommandLatency::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("ClearCommandLatency");
+    extern CommandProcessor command_processor;
+    command_processor.get_command_latency().clear();
+    auto response{Response{status ? "CCL" : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetTaskStats command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetTaskStats::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetTaskStats");
+    return status;
+}
+
+/**
+ * @brief Execute GetTaskStats command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * Each record is the task name, runs, overruns, and worst latency in milliseconds
+ *
+ */
+
+bool CommandGetTaskStats::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetTaskStats");
+    extern TaskScheduler scheduler;
+    ResponsePacker packer{"GTS"};
+    char record[task_record_limit]{};
+    for (size_t index{0}; index < scheduler.get_task_count(); ++index)
+    {
+        auto statistics{scheduler.get_statistics(index)};
+        auto length{snprintf(record, sizeof(record), "%s %lu %lu %lu", scheduler.get_task(index).name,
+                             static_cast<unsigned long>(statistics.runs), static_cast<unsigned long>(statistics.overruns),
+                             static_cast<unsigned long>(statistics.worst_latency))};
+        packer.add(record, static_cast<size_t>(length) < sizeof(record) ? static_cast<size_t>(length) : sizeof(record) - 1);
+    }
+    return packer.finish() && status;
+}
+
+/**
+ * @brief Acknowledge GetProfile command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetProfile::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetProfile");
+    return status;
+}
+
+/**
+ * @brief Execute GetProfile command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * The first record is the free memory low water mark and the current free memory in
+ * bytes. Each following record is the stage name, count, minimum, maximum, and mean
+ * microseconds, and the log2 histogram.
+ *
+ */
+
+bool CommandGetProfile::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetProfile");
+    extern Profiler profiler;
+    ResponsePacker packer{"GPF"};
+    char record[radio_response_limit + 1]{};
+    auto low_water{profiler.get_free_memory_low_water()};
+    auto available{Profiler::free_memory()};
+    auto length{snprintf(record, sizeof(record), "%lu %lu", static_cast<unsigned long>(low_water < available ? low_water : available),
+                         static_cast<unsigned long>(available))};
+    packer.add(record, static_cast<size_t>(length));
+    for (size_t stage{0}; stage < profiler.get_stage_count(); ++stage)
+    {
+        auto name_length{static_cast<size_t>(snprintf(record, sizeof(record), "%s", profiler.get_stage_name(stage)))};
+        auto statistics_length{profiler.format(stage, record + name_length, sizeof(record) - name_length)};
+        packer.add(record, name_length + statistics_length);
+    }
+    return packer.finish() && status;
+}
+
+/**
+ * @brief Acknowledge ClearProfile command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearProfile::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("ClearProfile");
+    return status;
+}
+
+/**
+ * @brief Execute ClearProfile command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandClearProfile::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("ClearProfile");
+    extern Profiler profiler;
+    profiler.clear();
+    auto response{Response{status ? "CPF" : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetDutyCycle command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetDutyCycle::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetDutyCycle");
+    return status;
+}
+
+/**
+ * @brief Execute GetDutyCycle command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * Replies with the milliseconds elapsed and in the idle loop, the time outside the idle
+ * loop in tenths of a percent, and the number of times the processor went idle, then
+ * starts a new measurement window. The processor wakes every millisecond while idle, so
+ * idle time is not time with the CPU clock stopped.
+ *
+ */
+
+bool CommandGetDutyCycle::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetDutyCycle");
+    extern IdleManager idle_manager;
+    auto duty_cycle{idle_manager.get_duty_cycle()};
+    idle_manager.restart_duty_cycle();
+    auto asleep{duty_cycle.asleep < duty_cycle.elapsed ? duty_cycle.asleep : duty_cycle.elapsed};
+    auto awake{duty_cycle.elapsed == 0 ? 0 : static_cast<unsigned long>(1000ull * (duty_cycle.elapsed - asleep) / duty_cycle.elapsed)};
+    char text[radio_response_limit + 1]{};
+    snprintf(text, sizeof(text), "GDC %lu %lu %lu %lu", static_cast<unsigned long>(duty_cycle.elapsed), static_cast<unsigned long>(asleep),
+             awake, static_cast<unsigned long>(duty_cycle.sleeps));
+    auto response{Response{status ? text : "ERR"}};
+    return response.send() && status;
+}
+
+/**
+ * @brief Acknowledge GetBootTimeline command
+ *
+ * @return true successful
+ * @return false error
+ */
+
+bool CommandGetBootTimeline::acknowledge_receipt() const
+{
+    auto status{Command::acknowledge_receipt()};
+    Log.verboseln("GetBootTimeline");
+    return status;
+}
+
+/**
+ * @brief Execute GetBootTimeline command
+ *
+ * @return true successful
+ * @return false error
+ *
+ * Each record is the name of a boot phase reached and the milliseconds since power on
+ * when it was reached
+ *
+ */
+
+bool CommandGetBootTimeline::execute() const
+{
+    auto status{Command::execute()};
+    Log.verboseln("GetBootTimeline");
+    extern Startup startup;
+    ResponsePacker packer{"GBT"};
+    char record[task_record_limit]{};
+    for (size_t index{0}; index < boot_phase_count; ++index)
+    {
+        auto phase{static_cast<BootPhase>(index)};
+        if (startup.phase_reached(phase))
+        {
+            auto length{snprintf(record, sizeof(record), "%s %lu", Startup::phase_name(phase), startup.get_phase_time(phase))};
+            packer.add(record, static_cast<size_t>(length));
+        }
+    }
+    return packer.finish() && status;
+}
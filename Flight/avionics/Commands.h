@@ -10,14 +10,16 @@
 #pragma once
 
 #include "avionics_constants.h"
+#include "CommandToken.h"
+#include "StoredCommands.h"
 #include "RTClib.h"
 
 class Command
 {
 public:
     virtual ~Command() = default;
-    virtual bool validate_arguments(const String tokens[], const size_t token_count) const;
-    virtual bool load_data(const String tokens[], const size_t token_count);
+    virtual bool validate_arguments(const CommandToken tokens[], const size_t token_count) const;
+    virtual bool load_data(const CommandToken tokens[], const size_t token_count);
     virtual bool acknowledge_receipt() const;
     virtual bool negative_acknowledge_receipt() const;
     virtual bool execute() const;
@@ -26,57 +28,57 @@ public:
 class CommandSetClock final : public Command
 {
 public:
-    explicit CommandSetClock(const DateTime time) : m_time{time} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandSetClock() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
     void time(const DateTime time) { m_time = time; }
 
 private:
-    DateTime m_time;
+    DateTime m_time{}; // parsed by load_data
 };
 
 class CommandBeaconSp final : public Command
 {
 public:
-    explicit CommandBeaconSp(const int seconds) : m_seconds{seconds} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandBeaconSp() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
     void seconds(const int seconds) { m_seconds = seconds; }
 
 private:
-    int m_seconds;
+    int m_seconds{0};
 };
 
 class CommandPicTimes final : public Command
 {
 public:
-    explicit CommandPicTimes(const DateTime time) : m_time{time} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandPicTimes() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
     void time(const DateTime time) { m_time = time; }
 
 private:
-    DateTime m_time;
+    DateTime m_time{}; // parsed by load_data
 };
 
 class CommandSSDVTimes final : public Command
 {
 public:
-    explicit CommandSSDVTimes(const DateTime time) : m_time{time} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandSSDVTimes() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
     void time(const DateTime time) { m_time = time; }
 
 private:
-    DateTime m_time;
+    DateTime m_time{}; // parsed by load_data
 };
 
 class CommandClearPayloadQueue final : public Command
@@ -99,8 +101,13 @@ class CommandGetPayloadQueue final : public Command
 {
 public:
     CommandGetPayloadQueue() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
+
+private:
+    bool m_compact{false};
 };
 
 class CommandGetTelemetry final : public Command
@@ -127,6 +134,14 @@ public:
     bool execute() const override;
 };
 
+class CommandGetLinkStats final : public Command
+{
+public:
+    CommandGetLinkStats() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
 class CommandGetBeaconInterval final : public Command
 {
 public:
@@ -202,27 +217,27 @@ public:
 class CommandLogArguments final : public Command
 {
 public:
-    explicit CommandLogArguments(const String arguments) : m_arguments{arguments} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandLogArguments() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
 
 private:
-    String m_arguments;
+    String m_arguments{};
 };
 
 class CommandBackgroundRSSI final : public Command
 {
 public:
-    explicit CommandBackgroundRSSI(const String seconds) : m_seconds{seconds} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandBackgroundRSSI() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
 
 private:
-    String m_seconds;
+    String m_seconds{};
 };
 
 class CommandCurrentRSSI final : public Command
@@ -235,12 +250,128 @@ public:
 class CommandModifyCCA final : public Command
 {
 public:
-    explicit CommandModifyCCA(const String threshold) : m_threshold{threshold} {};
-    bool validate_arguments(const String tokens[], const size_t token_count) const override;
-    bool load_data(const String tokens[], const size_t token_count);
+    CommandModifyCCA() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
     bool acknowledge_receipt() const override;
     bool execute() const override;
 
 private:
-    String m_threshold;
+    String m_threshold{};
+};
+
+class CommandModifyBaud final : public Command
+{
+public:
+    CommandModifyBaud() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+
+private:
+    uint32_t m_baud_rate{0};
+};
+
+class CommandStoreCommand final : public Command
+{
+public:
+    CommandStoreCommand() = default;
+    bool validate_arguments(const CommandToken tokens[], const size_t token_count) const override;
+    bool load_data(const CommandToken tokens[], const size_t token_count) override;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+
+private:
+    DateTime m_time{};                       // parsed by load_data
+    char m_command[stored_command_length]{}; // stored command and arguments
+    size_t m_length{0};                      // characters in stored command
+};
+
+class CommandGetStoredCommands final : public Command
+{
+public:
+    CommandGetStoredCommands() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandClearStoredCommands final : public Command
+{
+public:
+    CommandClearStoredCommands() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetStoredResults final : public Command
+{
+public:
+    CommandGetStoredResults() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandClearStoredResults final : public Command
+{
+public:
+    CommandClearStoredResults() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetCommandLatency final : public Command
+{
+public:
+    CommandGetCommandLatency() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandClearCommandLatency final : public Command
+{
+public:
+    CommandClearCommandLatency() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetTaskStats final : public Command
+{
+public:
+    CommandGetTaskStats() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetProfile final : public Command
+{
+public:
+    CommandGetProfile() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandClearProfile final : public Command
+{
+public:
+    CommandClearProfile() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetDutyCycle final : public Command
+{
+public:
+    CommandGetDutyCycle() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
+};
+
+class CommandGetBootTimeline final : public Command
+{
+public:
+    CommandGetBootTimeline() = default;
+    bool acknowledge_receipt() const override;
+    bool execute() const override;
 };
\ No newline at end of file
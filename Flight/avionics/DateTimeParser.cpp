@@ -0,0 +1,288 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat date and time argument parser
+ *
+ * This file implements the parser which reads a date and time from command tokens.
+ * Three forms are accepted:
+ *
+ * YYYY MM DD hh mm ss: six tokens, fields after the year may have one or two digits
+ * YYYYMMDDThhmmss or YYYY-MM-DDThh:mm:ss: one ISO 8601 token, optionally ending in Z
+ * seconds: one token of five to ten digits, seconds since 1970
+ *
+ * The characters are read once, directly from the tokens, and nothing is allocated.
+ *
+ */
+
+#include "DateTimeParser.h"
+
+namespace
+{
+    constexpr uint16_t first_year{2000};                                            /**< first year DateTime represents @hideinitializer */
+    constexpr uint16_t last_year{2099};                                             /**< last year DateTime represents @hideinitializer */
+    constexpr uint32_t first_epoch{946684800ul};                                    /**< seconds since 1970 at the start of 2000 @hideinitializer */
+    constexpr size_t compact_iso_length{15};                                        /**< characters in YYYYMMDDThhmmss @hideinitializer */
+    constexpr size_t extended_iso_length{19};                                       /**< characters in YYYY-MM-DDThh:mm:ss @hideinitializer */
+    constexpr size_t maximum_epoch_digits{10};                                      /**< digits in the largest seconds since 1970 @hideinitializer */
+    constexpr size_t minimum_epoch_digits{5};                                       /**< fewer digits is a year or a field @hideinitializer */
+    constexpr uint8_t month_days[]{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}; /**< days in each month of a common year @hideinitializer */
+
+    /**
+     * @brief Date and time fields
+     *
+     */
+
+    struct Fields
+    {
+        uint16_t year;
+        uint16_t month;
+        uint16_t day;
+        uint16_t hour;
+        uint16_t minute;
+        uint16_t second;
+    };
+
+    /**
+     * @brief Read a fixed number of decimal digits
+     *
+     */
+
+    bool read_digits(const char *text, const size_t digits, uint16_t &value)
+    {
+        value = 0;
+        for (size_t index{0}; index < digits; ++index)
+        {
+            auto digit{static_cast<uint8_t>(text[index] - '0')};
+            if (digit > 9)
+            {
+                return false;
+            }
+            value = static_cast<uint16_t>(value * 10 + digit);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Read a token of one or two decimal digits
+     *
+     */
+
+    bool read_field(const CommandToken &token, uint16_t &value)
+    {
+        return token.length() >= 1 && token.length() <= 2 && read_digits(token.c_str(), token.length(), value);
+    }
+
+    /**
+     * @brief Check for a leap year
+     *
+     */
+
+    constexpr bool leap_year(const uint16_t year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    /**
+     * @brief Read the six token form
+     *
+     */
+
+    bool read_fields(const CommandToken tokens[], Fields &fields)
+    {
+        return read_digits(tokens[0].c_str(), 4, fields.year) && read_field(tokens[1], fields.month) &&
+               read_field(tokens[2], fields.day) && read_field(tokens[3], fields.hour) &&
+               read_field(tokens[4], fields.minute) && read_field(tokens[5], fields.second);
+    }
+
+    /**
+     * @brief Read the ISO 8601 form
+     *
+     */
+
+    bool read_iso(const CommandToken &token, Fields &fields)
+    {
+        auto text{token.c_str()};
+        auto length{token.length()};
+        if (length > 0 && text[length - 1] == 'Z')
+        {
+            --length;
+        }
+        if (length == compact_iso_length)
+        {
+            return text[8] == 'T' && read_digits(text, 4, fields.year) && read_digits(text + 4, 2, fields.month) &&
+                   read_digits(text + 6, 2, fields.day) && read_digits(text + 9, 2, fields.hour) &&
+                   read_digits(text + 11, 2, fields.minute) && read_digits(text + 13, 2, fields.second);
+        }
+        if (length == extended_iso_length)
+        {
+            return text[4] == '-' && text[7] == '-' && text[10] == 'T' && text[13] == ':' && text[16] == ':' &&
+                   read_digits(text, 4, fields.year) && read_digits(text + 5, 2, fields.month) &&
+                   read_digits(text + 8, 2, fields.day) && read_digits(text + 11, 2, fields.hour) &&
+                   read_digits(text + 14, 2, fields.minute) && read_digits(text + 17, 2, fields.second);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Read the seconds since 1970 form
+     *
+     */
+
+    bool read_epoch(const CommandToken &token, uint32_t &seconds)
+    {
+        uint64_t value{0};
+        for (size_t index{0}; index < token.length(); ++index)
+        {
+            auto digit{static_cast<uint8_t>(token[index] - '0')};
+            if (digit > 9)
+            {
+                return false;
+            }
+            value = value * 10 + digit;
+        }
+        if (value > UINT32_MAX)
+        {
+            return false;
+        }
+        seconds = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    /**
+     * @brief Validate the fields against the calendar
+     *
+     */
+
+    DateTimeError validate(const Fields &fields)
+    {
+        if (fields.year < first_year || fields.year > last_year)
+        {
+            return DateTimeError::year;
+        }
+        if (fields.month < 1 || fields.month > 12)
+        {
+            return DateTimeError::month;
+        }
+        auto days{fields.month == 2 && leap_year(fields.year) ? 29 : month_days[fields.month - 1]};
+        if (fields.day < 1 || fields.day > days)
+        {
+            return DateTimeError::day;
+        }
+        if (fields.hour > 23)
+        {
+            return DateTimeError::hour;
+        }
+        if (fields.minute > 59)
+        {
+            return DateTimeError::minute;
+        }
+        if (fields.second > 59)
+        {
+            return DateTimeError::second;
+        }
+        return DateTimeError::none;
+    }
+}
+
+/**
+ * @brief Parse a date and time
+ *
+ * @param tokens command tokens
+ * @param token_count number of tokens
+ * @param first index of the first date and time token
+ * @param[out] time parsed date and time, set only if valid
+ * @param[out] consumed number of tokens used, set only if valid
+ * @return DateTimeError none if valid, otherwise the first error found
+ *
+ * The form is selected by the first token: four digits start the six token form, a T
+ * marks the ISO 8601 form, and five to ten digits are seconds since 1970.
+ *
+ */
+
+DateTimeError parse_date_time(const CommandToken tokens[], const size_t token_count, const size_t first, DateTime &time, size_t &consumed)
+{
+    if (first >= token_count)
+    {
+        return DateTimeError::missing;
+    }
+    const auto &token{tokens[first]};
+    Fields fields{};
+    size_t used{1};
+    if (token.length() == 4)
+    {
+        if (first + 6 > token_count)
+        {
+            return DateTimeError::missing;
+        }
+        if (!read_fields(tokens + first, fields))
+        {
+            return DateTimeError::format;
+        }
+        used = 6;
+    }
+    else if (token.length() >= minimum_epoch_digits && token.length() <= maximum_epoch_digits)
+    {
+        uint32_t seconds{0};
+        if (!read_epoch(token, seconds))
+        {
+            return DateTimeError::format;
+        }
+        if (seconds < first_epoch)
+        {
+            return DateTimeError::year;
+        }
+        DateTime epoch_time{seconds};
+        if (epoch_time.year() > last_year)
+        {
+            return DateTimeError::year;
+        }
+        time = epoch_time;
+        consumed = used;
+        return DateTimeError::none;
+    }
+    else if (!read_iso(token, fields))
+    {
+        return DateTimeError::format;
+    }
+    auto error{validate(fields)};
+    if (error == DateTimeError::none)
+    {
+        time = DateTime{fields.year, static_cast<uint8_t>(fields.month), static_cast<uint8_t>(fields.day),
+                        static_cast<uint8_t>(fields.hour), static_cast<uint8_t>(fields.minute), static_cast<uint8_t>(fields.second)};
+        consumed = used;
+    }
+    return error;
+}
+
+/**
+ * @brief Name a date and time error for logging
+ *
+ * @param error parse result
+ * @return const char* description
+ *
+ */
+
+const char *date_time_error_name(const DateTimeError error)
+{
+    switch (error)
+    {
+    case DateTimeError::none:
+        return "none";
+    case DateTimeError::missing:
+        return "missing fields";
+    case DateTimeError::format:
+        return "invalid format";
+    case DateTimeError::year:
+        return "invalid year";
+    case DateTimeError::month:
+        return "invalid month";
+    case DateTimeError::day:
+        return "invalid day";
+    case DateTimeError::hour:
+        return "invalid hour";
+    case DateTimeError::minute:
+        return "invalid minute";
+    case DateTimeError::second:
+        return "invalid second";
+    }
+    return "unknown";
+}
@@ -0,0 +1,33 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat date and time argument parser
+ *
+ * This file declares the parser which reads a date and time from command tokens
+ *
+ */
+
+#pragma once
+
+#include "CommandToken.h"
+#include "RTClib.h"
+
+/**
+ * @brief Date and time parse result
+ *
+ */
+
+enum class DateTimeError : uint8_t
+{
+    none,    /**< valid date and time */
+    missing, /**< too few tokens */
+    format,  /**< unrecognized form or non-digit character */
+    year,    /**< year outside 2000 to 2099 */
+    month,   /**< month outside 1 to 12 */
+    day,     /**< day outside the month */
+    hour,    /**< hour outside 0 to 23 */
+    minute,  /**< minute outside 0 to 59 */
+    second,  /**< second outside 0 to 59 */
+};
+
+DateTimeError parse_date_time(const CommandToken tokens[], const size_t token_count, const size_t first, DateTime &time, size_t &consumed);
+const char *date_time_error_name(const DateTimeError error);
@@ -37,6 +37,16 @@ void ExternalWatchdog::service()
   };
 };
 
+/**
+ * @brief Time at which service() will next trigger the watchdog
+ *
+ */
+
+unsigned long ExternalWatchdog::next_service_time() const
+{
+  return m_last_action_time + watchdog_lower_boundary + 1;
+};
+
 /**
  * @brief Set force reset
  *
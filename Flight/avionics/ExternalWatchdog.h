@@ -37,6 +37,13 @@ public:
 
   void service();
 
+  /**
+   * @brief Time at which service() will next trigger the watchdog
+   *
+   */
+
+  unsigned long next_service_time() const;
+
   /**
    * @brief Set force reset
    *
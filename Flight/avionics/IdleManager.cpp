@@ -0,0 +1,95 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat idle manager
+ *
+ * This file implements the class which sleeps the processor between process loop passes
+ * until the next scheduled work and keeps the duty cycle achieved
+ *
+ */
+
+#include "IdleManager.h"
+#include "AvionicsBoard.h"
+#include "RadioBoard.h"
+#include "TaskScheduler.h"
+
+/**
+ * @brief Sleep until the next scheduled work
+ *
+ * Each WFI ends at the next SysTick interrupt at the latest, so the processor sleeps a
+ * millisecond at a time and checks for work between sleeps. Interrupts are disabled
+ * while checking so that a character received or a task released just before sleeping
+ * still wakes the processor; the pending interrupt ends WFI and is serviced when
+ * interrupts are enabled again.
+ *
+ */
+
+void IdleManager::sleep()
+{
+    extern RadioBoard radio;
+    auto start{micros()};
+    auto slept{false};
+    while (true)
+    {
+        __disable_irq();
+        if (static_cast<int32_t>(next_deadline() - millis()) <= 0 || radio.receive_pending())
+        {
+            __enable_irq();
+            break;
+        }
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+        PM->SLEEP.reg = PM_SLEEP_IDLE_CPU;
+        __DSB();
+        __WFI();
+        __enable_irq();
+        slept = true;
+    }
+    if (slept)
+    {
+        ++m_sleeps;
+        m_asleep += micros() - start;
+    }
+}
+
+/**
+ * @brief Get the duty cycle statistics
+ *
+ * @return DutyCycle elapsed and asleep time and sleeps since the window started
+ *
+ */
+
+DutyCycle IdleManager::get_duty_cycle() const
+{
+    DutyCycle duty_cycle{};
+    duty_cycle.elapsed = millis() - m_window_start;
+    duty_cycle.asleep = static_cast<uint32_t>(m_asleep / milliseconds_to_microseconds);
+    duty_cycle.sleeps = m_sleeps;
+    return duty_cycle;
+}
+
+/**
+ * @brief Start a new duty cycle measurement window
+ *
+ */
+
+void IdleManager::restart_duty_cycle()
+{
+    m_window_start = millis();
+    m_asleep = 0;
+    m_sleeps = 0;
+}
+
+/**
+ * @brief Time of the next scheduled work
+ *
+ * @return unsigned long the sooner of the next task release and the next watchdog trigger in milliseconds
+ *
+ */
+
+unsigned long IdleManager::next_deadline() const
+{
+    extern TaskScheduler scheduler;
+    extern AvionicsBoard avionics;
+    unsigned long release{scheduler.next_release()};
+    auto watchdog{avionics.get_watchdog_due()};
+    return static_cast<int32_t>(watchdog - release) < 0 ? watchdog : release;
+}
@@ -0,0 +1,60 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat idle manager
+ *
+ * This file declares the class which sleeps the processor between process loop passes
+ * until the next scheduled work and keeps the duty cycle achieved
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+/**
+ * @brief Duty cycle statistics
+ *
+ */
+
+struct DutyCycle
+{
+    uint32_t elapsed; /**< milliseconds in the measurement window */
+    uint32_t asleep;  /**< milliseconds in the idle loop in the window */
+    uint32_t sleeps;  /**< times the processor went idle in the window */
+};
+
+/**
+ * @brief Idle manager
+ *
+ * After each pass the processor waits in IDLE mode until the next periodic task release
+ * or the next watchdog trigger, whichever is sooner, instead of spinning through empty
+ * passes. IDLE stops only the CPU clock, and the SysTick interrupt which keeps millis()
+ * ends each WFI, so a single sleep lasts at most one millisecond; the idle loop then
+ * checks for work and sleeps again. The Serial1 receive interrupt and the attached
+ * payload pin interrupts also wake it, and the loop ends early when
+ * received characters are waiting or a pin interrupt releases a task.
+ *
+ * The asleep time is the time spent in the idle loop, which includes servicing SysTick
+ * and the other interrupts each millisecond. It shows how much of the time the process
+ * loop has no work, not the time the CPU clock is stopped, and is not a measure of
+ * power saved.
+ *
+ * Neither SysTick nor STANDBY is stopped: the SAMD core keeps the millisecond count
+ * privately, so ticks skipped while SysTick was off could not be added back to millis(),
+ * and STANDBY stops the clocks which drive millis() and the Serial1 SERCOM.
+ *
+ */
+
+class IdleManager final
+{
+public:
+    void sleep();
+    DutyCycle get_duty_cycle() const;
+    void restart_duty_cycle();
+
+private:
+    unsigned long next_deadline() const;
+    unsigned long m_window_start{0}; // start of the measurement window in milliseconds
+    uint64_t m_asleep{0};            // microseconds asleep in the window
+    uint32_t m_sleeps{0};            // times slept in the window
+};
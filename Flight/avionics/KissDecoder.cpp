@@ -0,0 +1,252 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat KISS decoder
+ *
+ * This file implements the table driven decoder for KISS frames received from the Radio Board
+ *
+ */
+
+#include "KissDecoder.h"
+
+namespace
+{
+    /**
+     * @brief Decoder states
+     *
+     */
+
+    enum State : uint8_t
+    {
+        outside, /**< waiting for FEND */
+        start,   /**< FEND received, no content yet */
+        data,    /**< receiving content */
+        escape,  /**< FESC received */
+        state_count,
+    };
+
+    /**
+     * @brief Received byte classes
+     *
+     */
+
+    enum ByteClass : uint8_t
+    {
+        fend,
+        fesc,
+        tfend,
+        tfesc,
+        other,
+        class_count,
+    };
+
+    /**
+     * @brief Actions performed on a transition
+     *
+     */
+
+    enum Action : uint8_t
+    {
+        none,          /**< no action */
+        store,         /**< store received byte */
+        store_fend,    /**< store escaped FEND */
+        store_fesc,    /**< store escaped FESC */
+        end,           /**< frame complete if content received */
+        outside_error, /**< count byte received outside frame */
+        escape_error,  /**< count invalid escaped byte, byte ignored */
+        discard,       /**< discard frame */
+    };
+
+    constexpr uint8_t action_shift{2};                       /**< number of state bits in table entry @hideinitializer */
+    constexpr uint8_t state_mask{(1u << action_shift) - 1u}; /**< mask for state in table entry @hideinitializer */
+    static_assert(state_count <= state_mask + 1u, "Decoder states do not fit in table entry");
+
+    /**
+     * @brief Build a table entry
+     *
+     */
+
+    constexpr uint8_t entry(const Action action, const State next)
+    {
+        return static_cast<uint8_t>((action << action_shift) | next);
+    }
+
+    /**
+     * @brief Transition table indexed by state and byte class
+     *
+     * Columns are FEND, FESC, TFEND, TFESC, and other bytes
+     *
+     */
+
+    constexpr uint8_t transitions[state_count][class_count]{
+        // outside
+        {entry(none, start), entry(outside_error, outside), entry(outside_error, outside), entry(outside_error, outside), entry(outside_error, outside)},
+        // start
+        {entry(none, start), entry(none, escape), entry(store, data), entry(store, data), entry(store, data)},
+        // data
+        {entry(end, start), entry(none, escape), entry(store, data), entry(store, data), entry(store, data)},
+        // escape
+        {entry(discard, start), entry(discard, outside), entry(store_fend, data), entry(store_fesc, data), entry(escape_error, data)},
+    };
+
+    /**
+     * @brief Classify a received byte
+     *
+     */
+
+    constexpr uint8_t classify(const uint8_t character)
+    {
+        return character == FEND ? fend : character == FESC ? fesc : character == TFEND ? tfend : character == TFESC ? tfesc : other;
+    }
+}
+
+/**
+ * @brief Decode received characters
+ *
+ * @param input received characters
+ * @param length number of received characters
+ * @param output buffer for the frame being decoded, the same buffer until the frame is taken
+ * @param capacity size of output buffer
+ * @return size_t number of characters used
+ *
+ * Stops after the character completing or discarding a frame. A completed frame
+ * must be taken with take_frame() before decoding continues.
+ *
+ */
+
+size_t KissDecoder::decode(const uint8_t *input, const size_t length, char *output, const size_t capacity)
+{
+    if (m_frame_complete)
+    {
+        return 0;
+    }
+    auto state{static_cast<State>(m_state)};
+    auto frame_length{m_length};
+    size_t index{0};
+    while (index < length)
+    {
+        auto character{input[index++]};
+        auto transition{transitions[state][classify(character)]};
+        auto action{transition >> action_shift};
+        state = static_cast<State>(transition & state_mask);
+        switch (action)
+        {
+        case none:
+            break;
+        case store:
+        case store_fend:
+        case store_fesc:
+            if (frame_length < capacity)
+            {
+                output[frame_length++] = static_cast<char>(action == store ? character : action == store_fend ? FEND : FESC);
+            }
+            else
+            {
+                ++m_overflow_errors;
+            }
+            break;
+        case end:
+            if (frame_length > 0)
+            {
+                m_frame_complete = true;
+                m_state = state;
+                m_length = frame_length;
+                return index;
+            }
+            break;
+        case outside_error:
+            ++m_outside_frame_errors;
+            break;
+        case escape_error:
+            ++m_escape_errors;
+            break;
+        case discard:
+            ++m_aborted_frames;
+            m_state = state;
+            m_length = 0;
+            return index;
+        }
+    }
+    m_state = state;
+    m_length = frame_length;
+    return index;
+}
+
+/**
+ * @brief Check for a decoded frame
+ *
+ * @return true frame complete
+ * @return false frame not complete
+ *
+ */
+
+bool KissDecoder::frame_complete() const
+{
+    return m_frame_complete;
+}
+
+/**
+ * @brief Characters decoded in the current frame
+ *
+ * @return size_t characters decoded, zero after a frame is discarded
+ *
+ */
+
+size_t KissDecoder::length() const
+{
+    return m_length;
+}
+
+/**
+ * @brief Take the decoded frame and start the next
+ *
+ * @return size_t characters in frame
+ *
+ */
+
+size_t KissDecoder::take_frame()
+{
+    auto length{m_length};
+    m_length = 0;
+    m_frame_complete = false;
+    return length;
+}
+
+/**
+ * @brief Number of characters received outside a frame
+ *
+ */
+
+uint32_t KissDecoder::outside_frame_errors() const
+{
+    return m_outside_frame_errors;
+}
+
+/**
+ * @brief Number of invalid characters following FESC
+ *
+ */
+
+uint32_t KissDecoder::escape_errors() const
+{
+    return m_escape_errors;
+}
+
+/**
+ * @brief Number of frames aborted
+ *
+ */
+
+uint32_t KissDecoder::aborted_frames() const
+{
+    return m_aborted_frames;
+}
+
+/**
+ * @brief Number of characters beyond the frame capacity
+ *
+ */
+
+uint32_t KissDecoder::overflow_errors() const
+{
+    return m_overflow_errors;
+}
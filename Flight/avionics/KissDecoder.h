@@ -0,0 +1,42 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat KISS decoder
+ *
+ * This file declares the table driven decoder for KISS frames received from the Radio Board
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+/**
+ * @brief KISS frame decoder
+ *
+ * Each received byte is classified and looked up in a (state x byte class) table
+ * which gives the next state and the action to perform. Errors are counted rather
+ * than logged so that decoding a buffer does no output.
+ *
+ */
+
+class KissDecoder final
+{
+public:
+    size_t decode(const uint8_t *input, const size_t length, char *output, const size_t capacity);
+    bool frame_complete() const;
+    size_t length() const;
+    size_t take_frame();
+    uint32_t outside_frame_errors() const;
+    uint32_t escape_errors() const;
+    uint32_t aborted_frames() const;
+    uint32_t overflow_errors() const;
+
+private:
+    uint8_t m_state{0};                 /**< decoder state, initially outside frame */
+    size_t m_length{0};                 /**< characters decoded in current frame */
+    bool m_frame_complete{false};       /**< frame awaiting take_frame() */
+    uint32_t m_outside_frame_errors{0}; /**< characters received outside a frame */
+    uint32_t m_escape_errors{0};        /**< invalid characters following FESC */
+    uint32_t m_aborted_frames{0};       /**< frames aborted by FESC followed by FESC or FEND */
+    uint32_t m_overflow_errors{0};      /**< characters beyond the frame capacity */
+};
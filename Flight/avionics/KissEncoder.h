@@ -0,0 +1,93 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat KISS encoder
+ *
+ * This file declares and implements the encoder which escapes outbound KISS frames as
+ * they are copied into a transmit queue
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+/**
+ * @brief Part of the content of an outbound frame
+ *
+ * Frames are encoded from a list of fragments so that content need not be
+ * assembled into a single string before sending
+ *
+ */
+
+struct Fragment
+{
+    const char *data; /**< fragment content, need not be zero terminated */
+    size_t length;    /**< characters in fragment */
+};
+
+/**
+ * @brief Largest encoded size of a frame
+ *
+ * @param length characters of frame content
+ * @return size_t queue bytes if every character and the command are escaped, with both delimiters
+ *
+ */
+
+constexpr size_t kiss_encoded_limit(const size_t length)
+{
+    return 2 * (length + 1) + 2;
+}
+
+/**
+ * @brief Stage a character, escaping KISS special characters
+ *
+ * @tparam Queue queue providing bool stage(uint8_t), such as RingBuffer
+ * @param queue transmit queue
+ * @param character character to add
+ * @return true successful
+ * @return false queue full
+ *
+ */
+
+template <typename Queue>
+bool kiss_stage_character(Queue &queue, const uint8_t character)
+{
+    switch (character)
+    {
+    case FEND:
+        return queue.stage(FESC) && queue.stage(TFEND);
+    case FESC:
+        return queue.stage(FESC) && queue.stage(TFESC);
+    default:
+        return queue.stage(character);
+    }
+}
+
+/**
+ * @brief Stage a complete KISS frame
+ *
+ * @tparam Queue queue providing bool stage(uint8_t), such as RingBuffer
+ * @param queue transmit queue
+ * @param command KISS command byte
+ * @param fragments frame content in order
+ * @param count number of fragments
+ * @return true frame staged, ready to commit
+ * @return false queue full, staged bytes must be discarded
+ *
+ */
+
+template <typename Queue>
+bool kiss_stage_frame(Queue &queue, const uint8_t command, const Fragment fragments[], const size_t count)
+{
+    auto staged{queue.stage(FEND) && kiss_stage_character(queue, command)};
+    for (size_t fragment{0}; staged && fragment < count; ++fragment)
+    {
+        auto data{fragments[fragment].data};
+        auto length{fragments[fragment].length};
+        for (size_t index{0}; staged && index < length; ++index)
+        {
+            staged = kiss_stage_character(queue, static_cast<uint8_t>(data[index]));
+        }
+    }
+    return staged && queue.stage(FEND);
+}
@@ -0,0 +1,157 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat log2 histogram
+ *
+ * This file declares and implements the histogram of times used by the profiler and
+ * the command latency statistics
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+/**
+ * @brief Log2 histogram of times in microseconds
+ *
+ * @tparam Count count type, uint8_t or uint16_t
+ * @tparam BucketCount number of buckets, at most 16
+ * @tparam FirstLog2 bucket 0 holds times below 2^FirstLog2 microseconds
+ *
+ * Bucket 0 counts times below 2^FirstLog2 microseconds, bucket n counts times from
+ * 2^(FirstLog2+n-1) up to 2^(FirstLog2+n) microseconds, and the last bucket counts all
+ * longer times. When a bucket is full all buckets are halved, so the histogram keeps
+ * its shape.
+ *
+ */
+
+template <typename Count, size_t BucketCount, uint8_t FirstLog2>
+class Log2Histogram final
+{
+    static_assert(BucketCount <= 16, "Bucket index must be one hexadecimal digit");
+
+public:
+    /**
+     * @brief Count a time
+     *
+     * @param microseconds time measured
+     *
+     */
+
+    void record(const uint32_t microseconds)
+    {
+        auto &count{m_counts[bucket(microseconds)]};
+        if (count == static_cast<Count>(~Count{0}))
+        {
+            for (auto &value : m_counts)
+            {
+                value /= 2;
+            }
+        }
+        ++count;
+    }
+
+    /**
+     * @brief Check for counts
+     *
+     * @return true no times counted
+     *
+     */
+
+    bool empty() const
+    {
+        for (auto count : m_counts)
+        {
+            if (count != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Format the histogram
+     *
+     * @param[out] buffer formatted histogram, zero terminated
+     * @param capacity size of buffer
+     * @return size_t characters formatted, zero if the histogram does not fit
+     *
+     * A space, the hexadecimal index of the first nonzero bucket, a hyphen, and a
+     * hexadecimal count of two digits for each byte of Count for each bucket through
+     * the last nonzero bucket. A histogram with no counts is a space and a hyphen.
+     *
+     */
+
+    size_t format(char *buffer, const size_t capacity) const
+    {
+        constexpr char digits[]{"0123456789abcdef"};
+        constexpr size_t count_digits{2 * sizeof(Count)};
+        size_t first{0};
+        size_t last{BucketCount};
+        while (first < BucketCount && m_counts[first] == 0)
+        {
+            ++first;
+        }
+        while (last > first && m_counts[last - 1] == 0)
+        {
+            --last;
+        }
+        auto needed{first < last ? 3 + count_digits * (last - first) : 2};
+        if (needed >= capacity)
+        {
+            return 0;
+        }
+        size_t length{0};
+        buffer[length++] = ' ';
+        if (first < last)
+        {
+            buffer[length++] = digits[first];
+        }
+        buffer[length++] = '-';
+        for (auto index{first}; index < last; ++index)
+        {
+            for (auto shift{static_cast<int>(4 * (count_digits - 1))}; shift >= 0; shift -= 4)
+            {
+                buffer[length++] = digits[(m_counts[index] >> shift) & 0x0F];
+            }
+        }
+        buffer[length] = '\0';
+        return length;
+    }
+
+    /**
+     * @brief Reset all counts
+     *
+     */
+
+    void clear()
+    {
+        for (auto &count : m_counts)
+        {
+            count = 0;
+        }
+    }
+
+    /**
+     * @brief Select the bucket for a time
+     *
+     * @param microseconds time measured
+     * @return size_t bucket index
+     *
+     */
+
+    static size_t bucket(const uint32_t microseconds)
+    {
+        if (microseconds < (1ul << FirstLog2))
+        {
+            return 0;
+        }
+        auto log2{31u - static_cast<unsigned>(__builtin_clz(microseconds))};
+        auto index{log2 - FirstLog2 + 1};
+        return index < BucketCount ? index : BucketCount - 1;
+    }
+
+private:
+    Count m_counts[BucketCount]{}; // count of times in each bucket
+};
@@ -8,6 +8,8 @@
 
 #include "RadioBoard.h"
 
+    ResponseCollector *Message::m_collector{nullptr};
+
 
     /**
      * @brief Send message via the Radio Board
@@ -15,13 +17,33 @@
      * @return true success
      * @return false error
      *
+     * Responses are collected instead while a collector is installed
+     *
      */
 
     bool Message::send() {
+        if (m_command == response && m_collector != nullptr && m_collector->collect_response(m_content))
+        {
+            return true;
+        }
         extern RadioBoard radio;
         return radio.send_message(*this);
     }
 
+    /**
+     * @brief Install the collector of responses
+     *
+     */
+
+    void Message::set_collector(ResponseCollector *collector) { m_collector = collector; }
+
+    /**
+     * @brief Check whether responses are collected rather than sent
+     *
+     */
+
+    bool Message::collecting() { return m_collector != nullptr; }
+
     /**
      * @brief Get the command
      *
@@ -10,6 +10,18 @@
 
 #include "avionics_constants.h"
 
+/**
+ * @brief Destination of responses which are collected rather than sent
+ *
+ */
+
+class ResponseCollector
+{
+public:
+    virtual ~ResponseCollector() = default;
+    virtual bool collect_response(const String &content) = 0;
+};
+
 /**
  * @brief Messages sent by the Avionics Board
  *
@@ -38,6 +50,7 @@ public:
         background_rssi = BACKGROUND_RSSI,
         current_rssi = CURRENT_RSSI,
         modify_cca = MODIFY_CCA,
+        modify_baud_rate = MODIFY_BAUD_RATE,
     };
 
     /**
@@ -58,6 +71,24 @@ public:
 
     bool send();
 
+    /**
+     * @brief Install the collector of responses
+     *
+     * @param collector destination of responses, nullptr to send them
+     *
+     */
+
+    static void set_collector(ResponseCollector *collector);
+
+    /**
+     * @brief Check whether responses are collected rather than sent
+     *
+     * @return true collector installed
+     *
+     */
+
+    static bool collecting();
+
     /**
      * @brief Get the command
      *
@@ -75,4 +106,7 @@ public:
 protected:
     Type m_command{};
     String m_content{};
+
+private:
+    static ResponseCollector *m_collector; /**< installed while a batch or stored command is processed */
 };
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat process loop profiler
+ *
+ * This file implements the profiler which keeps the minimum, maximum, mean, and a log2
+ * histogram of the time spent in each process loop stage
+ *
+ */
+
+#include "Profiler.h"
+
+extern "C" char *sbrk(int increment);
+
+/**
+ * @brief Add a stage
+ *
+ * @param name stage name for reports, not copied
+ * @return size_t stage index, profile_stage_limit if there is no room
+ *
+ */
+
+size_t Profiler::add_stage(const char *name)
+{
+    if (m_count >= profile_stage_limit)
+    {
+        return profile_stage_limit;
+    }
+    m_names[m_count] = name;
+    m_statistics[m_count] = ProfileStatistics{};
+    return m_count++;
+}
+
+/**
+ * @brief Count the time spent in a stage
+ *
+ * @param stage stage index
+ * @param microseconds time spent
+ *
+ */
+
+void Profiler::record(const size_t stage, const uint32_t microseconds)
+{
+    auto available{free_memory()};
+    if (available < m_free_memory_low_water)
+    {
+        m_free_memory_low_water = available;
+    }
+    if (stage >= m_count)
+    {
+        return;
+    }
+    auto &statistics{m_statistics[stage]};
+    if (statistics.count == 0 || microseconds < statistics.minimum)
+    {
+        statistics.minimum = microseconds;
+    }
+    if (microseconds > statistics.maximum)
+    {
+        statistics.maximum = microseconds;
+    }
+    ++statistics.count;
+    statistics.total += microseconds;
+    statistics.histogram.record(microseconds);
+}
+
+/**
+ * @brief Number of stages
+ *
+ */
+
+size_t Profiler::get_stage_count() const
+{
+    return m_count;
+}
+
+/**
+ * @brief Get the name of a stage
+ *
+ * @param stage stage index, less than get_stage_count()
+ * @return const char* stage name
+ *
+ */
+
+const char *Profiler::get_stage_name(const size_t stage) const
+{
+    return m_names[stage];
+}
+
+/**
+ * @brief Get the statistics for a stage
+ *
+ * @param stage stage index, less than get_stage_count()
+ * @return const ProfileStatistics& statistics
+ *
+ */
+
+const ProfileStatistics &Profiler::get_statistics(const size_t stage) const
+{
+    return m_statistics[stage];
+}
+
+/**
+ * @brief Format the statistics for a stage
+ *
+ * @param stage stage index
+ * @param[out] buffer formatted statistics, zero terminated
+ * @param capacity size of buffer
+ * @return size_t characters formatted
+ *
+ * The statistics are a space and the count, minimum, maximum, and mean microseconds
+ * separated by spaces, then a space, the hexadecimal index of the first nonzero bucket,
+ * a hyphen, and four hexadecimal digits for each bucket through the last nonzero bucket.
+ * A stage with no counts has a hyphen in place of the histogram.
+ *
+ */
+
+size_t Profiler::format(const size_t stage, char *buffer, const size_t capacity) const
+{
+    if (capacity == 0)
+    {
+        return 0;
+    }
+    buffer[0] = '\0';
+    if (stage >= m_count)
+    {
+        return 0;
+    }
+    const auto &statistics{m_statistics[stage]};
+    auto mean{statistics.count == 0 ? 0 : static_cast<unsigned long>(statistics.total / statistics.count)};
+    auto written{snprintf(buffer, capacity, " %lu %lu %lu %lu", static_cast<unsigned long>(statistics.count),
+                          static_cast<unsigned long>(statistics.minimum), static_cast<unsigned long>(statistics.maximum), mean)};
+    if (written < 0 || static_cast<size_t>(written) >= capacity)
+    {
+        buffer[0] = '\0';
+        return 0;
+    }
+    auto length{static_cast<size_t>(written)};
+    return length + statistics.histogram.format(buffer + length, capacity - length);
+}
+
+/**
+ * @brief Least free memory seen while measuring stages
+ *
+ * @return size_t bytes between the heap and the stack, SIZE_MAX if nothing measured
+ *
+ */
+
+size_t Profiler::get_free_memory_low_water() const
+{
+    return m_free_memory_low_water;
+}
+
+/**
+ * @brief Reset the statistics for all stages and the free memory low water mark
+ *
+ */
+
+void Profiler::clear()
+{
+    for (size_t stage{0}; stage < m_count; ++stage)
+    {
+        m_statistics[stage] = ProfileStatistics{};
+    }
+    m_free_memory_low_water = SIZE_MAX;
+}
+
+/**
+ * @brief Free memory between the top of the heap and the stack
+ *
+ * @return size_t bytes free
+ *
+ */
+
+size_t Profiler::free_memory()
+{
+    char top{0};
+    return static_cast<size_t>(&top - sbrk(0));
+}
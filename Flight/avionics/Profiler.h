@@ -0,0 +1,97 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat process loop profiler
+ *
+ * This file declares the profiler which keeps the minimum, maximum, mean, and a log2
+ * histogram of the time spent in each process loop stage, and the scoped timer which
+ * measures a stage
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+#include "Log2Histogram.h"
+
+constexpr size_t profile_stage_limit{16};  /**< maximum profiled stages @hideinitializer */
+constexpr size_t profile_bucket_count{16}; /**< buckets in each histogram @hideinitializer */
+constexpr uint8_t profile_first_log2{4};   /**< bucket 0 holds times below 2^4 microseconds @hideinitializer */
+
+using ProfileHistogram = Log2Histogram<uint16_t, profile_bucket_count, profile_first_log2>; /**< histogram of stage times */
+
+/**
+ * @brief Stage statistics
+ *
+ */
+
+struct ProfileStatistics
+{
+    uint32_t count;             /**< times measured */
+    uint32_t minimum;           /**< shortest time in microseconds */
+    uint32_t maximum;           /**< longest time in microseconds */
+    uint64_t total;             /**< sum of times in microseconds */
+    ProfileHistogram histogram; /**< log2 histogram of times */
+};
+
+/**
+ * @brief Process loop profiler
+ *
+ * Stages are added by name and measured with a ScopedTimer. Bucket 0 of the histogram
+ * counts times below 16 microseconds. The free memory low water mark is sampled each
+ * time a stage is measured.
+ *
+ */
+
+class Profiler final
+{
+public:
+    size_t add_stage(const char *name);
+    void record(const size_t stage, const uint32_t microseconds);
+    size_t get_stage_count() const;
+    const char *get_stage_name(const size_t stage) const;
+    const ProfileStatistics &get_statistics(const size_t stage) const;
+    size_t format(const size_t stage, char *buffer, const size_t capacity) const;
+    size_t get_free_memory_low_water() const;
+    void clear();
+    static size_t free_memory();
+
+private:
+    const char *m_names[profile_stage_limit]{};            // stage names
+    ProfileStatistics m_statistics[profile_stage_limit]{}; // statistics for each stage
+    size_t m_count{0};                                     // number of stages
+    size_t m_free_memory_low_water{SIZE_MAX};              // least free memory seen in bytes
+};
+
+/**
+ * @brief Measure a process loop stage from construction to destruction
+ *
+ */
+
+class ScopedTimer final
+{
+public:
+    /**
+     * @brief Construct a new Scoped Timer object and start timing
+     *
+     * @param profiler profiler to record the time
+     * @param stage stage index from Profiler::add_stage()
+     *
+     */
+
+    ScopedTimer(Profiler &profiler, const size_t stage) : m_profiler(profiler), m_stage{stage}, m_start{micros()} {}
+
+    /**
+     * @brief Destroy the Scoped Timer object and record the time
+     *
+     */
+
+    ~ScopedTimer() { m_profiler.record(m_stage, micros() - m_start); }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+    Profiler &m_profiler;  // profiler to record the time
+    size_t m_stage;        // stage index
+    unsigned long m_start; // start time in microseconds
+};
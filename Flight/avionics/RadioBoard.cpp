@@ -12,16 +12,37 @@
 #include "log_utility.h"
 #include "AvionicsBoard.h"
 #include "Antenna.h"
+#include "TaskScheduler.h"
 
 /**
  * @brief Radio Board constants
  *
  */
 
-constexpr uint32_t serial1_baud_rate{19200};                                                        /**< speed of serial1 connection @hideinitializer */
+constexpr uint32_t serial1_baud_rate{19200};                                                        /**< initial and fallback speed of serial1 connection @hideinitializer */
+constexpr uint32_t radio_baud_rates[]{19200, 38400, 57600, 115200};                                 /**< speeds the Radio Board supports @hideinitializer */
+constexpr unsigned long baud_rate_response_timeout{2 * seconds_to_milliseconds};                    /**< wait for Radio Board to accept or confirm a speed @hideinitializer */
+constexpr unsigned long baud_rate_check_interval{10 * seconds_to_milliseconds};                     /**< interval for framing error check @hideinitializer */
+constexpr uint32_t baud_rate_framing_error_limit{8};                                                /**< framing errors per interval before fallback @hideinitializer */
 constexpr unsigned long radio_delay{2 * seconds_to_milliseconds};                                   /**< Radio Board startup delay */
 constexpr long ground_contact_interval{7};                                                          /**< maximum days without ground contact for beacon @hideinitializer */
 constexpr unsigned long frequency_entry_timeout = 30 * seconds_to_milliseconds; /**< User frequency entry delay */
+constexpr unsigned long radio_response_timeout{1 * seconds_to_milliseconds};      /**< Radio Board startup response delay */
+constexpr unsigned long transmit_space_timeout{1 * seconds_to_milliseconds};      /**< Wait for transmit queue space */
+
+/**
+ * @brief Serial1 interrupt service
+ *
+ * Replaces the weak handler in the variant. The Radio Board interface services the
+ * Serial1 SERCOM directly; the core Serial1 buffers are not used.
+ *
+ */
+
+void Serial1_Handler()
+{
+    extern RadioBoard radio;
+    radio.serial_interrupt();
+}
 
 /**
  * @brief Initialize the Radio Board
@@ -29,6 +50,9 @@ constexpr unsigned long frequency_entry_timeout = 30 * seconds_to_milliseconds;
  * @return true successful
  * @return false error
  *
+ * Starts the serial link and sends the abort transaction. The Radio Board startup
+ * delay and response probe are completed by check_radio().
+ *
  */
 
 bool RadioBoard::begin()
@@ -44,58 +68,114 @@ bool RadioBoard::begin()
 
     Log.verboseln("Initializing command port");
     Serial1.begin(serial1_baud_rate);
+    m_baud_rate = serial1_baud_rate;
     extern AvionicsBoard avionics;
     while (!Serial1)
     {
         avionics.service_watchdog();
     }
 
+    // Prepare ground command signature verification
+
+    m_verifier.begin();
+
     // Send abort transaction to Radio Board to clear buffer
 
     Log.verboseln("Sending abort transaction to Radio Board");
-    Serial1.write(FESC);
-    Serial1.write(FESC);
+    m_transmit_buffer.push(FESC);
+    m_transmit_buffer.push(FESC);
+    m_bytes_queued += 2;
+    m_transmit_hold_count = m_bytes_queued;
+    m_transmit_held = true;
+    PERIPH_SERIAL1.enableDataRegisterEmptyInterruptUART();
 
     // Wait for Radio Board to initialize
 
     Log.verboseln("Waiting for Radio Board to initialize");
-    unsigned long serial_delay_start{millis()};
-    while ((millis() - serial_delay_start) < radio_delay)
-    {
-        avionics.service_watchdog();
-    }
-
-    // Send invalid command to Radio Board to determine if it is responding
-
-    Log.verboseln("Sending invalid command to Radio Board");
-    Message message(Message::local_command, "Invalid");
-    message.send();
+    m_startup_state = RadioStartupState::waiting;
+    m_startup_state_start_time = millis();
+    return true;
+}
 
-    // Read radio response
+/**
+ * @brief Advance Radio Board startup
+ *
+ * @return true Radio Board responded to the probe
+ * @return false startup in progress or Radio Board not responding
+ *
+ * Messages queued while the Radio Board is initializing are held until the probe is sent
+ *
+ */
 
-    auto response_length{Serial1.readBytes(m_buffer, maximum_command_length)};
-    for (auto i{0}; i < static_cast<int>(response_length); ++i)
+bool RadioBoard::check_radio()
+{
+    switch (m_startup_state)
+    {
+    case RadioStartupState::startup:
+        break;
+    case RadioStartupState::waiting:
     {
-        Log.verboseln("Radio response: %C", m_buffer[i]);
+        if ((millis() - m_startup_state_start_time) >= radio_delay)
+        {
+            // Send invalid command to Radio Board to determine if it is responding
+
+            Log.verboseln("Sending invalid command to Radio Board");
+            m_probe_bytes_received = m_bytes_received;
+            m_probe_frames_received = m_statistics.frames_received;
+            m_startup_state = RadioStartupState::probing;
+            m_startup_state_start_time = millis();
+            Message message(Message::local_command, "Invalid");
+            message.send();
+            m_transmit_held = false;
+            if (m_transmit_buffer.available() > 0)
+            {
+                PERIPH_SERIAL1.enableDataRegisterEmptyInterruptUART();
+            }
+        }
+        break;
     }
-    if (response_length > 0)
+    case RadioStartupState::probing:
     {
-        Log.verboseln("Command port initialized");
+        if ((millis() - m_startup_state_start_time) >= radio_response_timeout)
+        {
+            receive_frames();
+            auto response_length{m_bytes_received - m_probe_bytes_received};
+            if (response_length == 0)
+            {
+                Log.errorln("Radio Board did not respond");
+                m_startup_state = RadioStartupState::not_responding;
+            }
+            else
+            {
+                if (m_statistics.frames_received == m_probe_frames_received)
+                {
+                    Log.warningln("Radio Board response of %l characters contained no frame", response_length);
+                }
+                Log.verboseln("Command port initialized");
+                m_startup_state = RadioStartupState::ready;
+            }
+            m_startup_state_start_time = millis();
+        }
+        break;
+    }
+    case RadioStartupState::ready:
         return true;
+    case RadioStartupState::not_responding:
+        break;
     }
-    Log.errorln("Radio Board did not respond");
     return false;
 }
 
 /**
- * @brief Gather frame from Serial1 port
+ * @brief Gather frames from Serial1 port
+ *
+ * @return size_t number of frames awaiting processing
  *
- * @return true frame received
- * @return false no frame or error
+ * Decodes all received characters, queueing each completed frame
  *
  */
 
-bool RadioBoard::receive_frame()
+size_t RadioBoard::receive_frames()
 {
     // Increment days since last ground contact if a day has passed
 
@@ -105,128 +185,68 @@ bool RadioBoard::receive_frame()
         m_milliseconds_since_last_ground_contact_day = millis();
     }
 
-    // if data available, process it
+    // if data available, process it in place in the receive buffer
 
-    while (Serial1.available())
+    const uint8_t *data{};
+    size_t length{};
+    while ((length = m_receive_buffer.peek(data)) > 0)
     {
-        auto character{static_cast<char>(Serial1.read())};
-        // Log.verboseln("Character received on Serial1 port: %C", character);
-        switch (character)
+        size_t used{0};
+        while (used < length)
         {
-        case FEND:
-            // Not in frame, start frame
-            if (!m_in_frame)
+            auto &slot{decoding_slot()};
+            used += m_decoder.decode(data + used, length - used, slot.data, maximum_command_length);
+            verify_frame(slot, m_decoder.length());
+            if (m_decoder.frame_complete())
             {
-                start_frame();
-            }
-            // In frame and data captured, process end of frame
-            else if (m_buffer_index > 0)
-            {
-                end_frame();
+                commit_frame(m_decoder.take_frame());
                 ground_contact();
-                return true;
             }
-            // In frame and no data captured, ignore subsequent FEND
-            else
-            {
-                Log.noticeln("Additional FEND received, ignored");
-            }
-            break;
-        case FESC:
-            // Not in frame, error
-            if (!m_in_frame)
-            {
-                Log.warningln("FESC received outside of frame, ignored");
-            }
-            // Two sequential FESCs, abort frame
-            else if (m_received_escape)
-            {
-                Log.errorln("Two FESCs in sequence, frame ignored");
-                end_frame();
-            }
-            // Process escape character
-            else
-            {
-                enter_escape_mode();
-            }
-            break;
-        case TFEND:
-            // Not in frame, error
-            if (!m_in_frame)
-            {
-                Log.warningln("TFEND received outside of frame, ignored");
-            }
-            // Not in escape mode, add to buffer
-            else if (!m_received_escape)
-            {
-                add_character_to_buffer(TFEND);
-            }
-            // In escape mode, add escaped character to buffer
-            else
-            {
-                add_character_to_buffer(FEND);
-                exit_escape_mode();
-            }
-            break;
-        case TFESC:
-            // Not in frame, error
-            if (!m_in_frame)
-            {
-                Log.warningln("TFESC received outside of frame, ignored");
-            }
-            // Not in escape mode, add to buffer
-            else if (!m_received_escape)
-            {
-                add_character_to_buffer(TFESC);
-            }
-            // In escape mode, process escape character
-            else
-            {
-                add_character_to_buffer(FESC);
-                exit_escape_mode();
-            }
-            break;
-        default:
-            // Not in frame, error
-            if (!m_in_frame)
-            {
-                Log.errorln("Data received outside of frame, ignored: %X", character);
-            }
-            // Escape received, must be TFEND or TFESC case, else error
-            else if (m_received_escape)
-            {
-                Log.errorln("Invalid escaped character, character ignored: %X", character);
-                exit_escape_mode();
-            }
-            // if in frame, add character to buffer and increment index
-            else
-            {
-                add_character_to_buffer(character);
-            }
-            break;
         }
+        m_receive_buffer.consume(length);
     }
-    return false;
+    return m_frame_count;
 }
 
 /**
  * @brief Get frame
  *
- * @return data from last radio frame
+ * @return oldest queued radio frame
  *
- * @note must be called after receive_frame() returns true and before next receive_frame() call
+ * @note must be called only when receive_frames() reports frames awaiting processing,
+ * the frame refers to the queue until release_frame() is called
  *
  */
 
 Frame RadioBoard::get_frame()
 {
-    m_buffer[m_buffer_index] = '\0';
+    auto &slot{m_frames[m_frame_first]};
     Frame frame{};
-    frame.type = m_buffer[0];
-    frame.command = String{m_buffer + 1};
+    frame.type = slot.data[0];
+    frame.command = slot.data + 1;
+    frame.length = slot.length - 1;
+    frame.signature_valid = slot.signature_valid;
+    frame.sequence = slot.sequence;
+    frame.signature_length = slot.signature_length;
     return frame;
 }
 
+/**
+ * @brief Release the oldest queued frame
+ *
+ */
+
+void RadioBoard::release_frame()
+{
+    if (m_frame_count == 0)
+    {
+        return;
+    }
+    m_frame_first = (m_frame_first + 1) % (radio_frame_queue_size + 1);
+    --m_frame_count;
+    ++m_statistics.frames_processed;
+}
+
 /**
  * @brief Send message
  *
@@ -235,7 +255,7 @@ Frame RadioBoard::get_frame()
  *
  */
 
-bool RadioBoard::send_message(const Message message) const
+bool RadioBoard::send_message(const Message message)
 {
     auto command = message.get_command();
     auto content = message.get_content();
@@ -247,6 +267,51 @@ bool RadioBoard::send_message(const Message message) const
     {
         Log.noticeln("Sending message: KISS command %X, content: %s", command, content.c_str());
     }
+    if (!transmit_allowed(command))
+    {
+        return false;
+    }
+    const Fragment fragment{content.c_str(), content.length()};
+    return queue_frame(command, &fragment, 1);
+}
+
+/**
+ * @brief Send message composed of fragments
+ *
+ * @param command KISS command byte
+ * @param fragments frame content in order
+ * @param count number of fragments
+ * @return true successful
+ * @return false error
+ *
+ */
+
+bool RadioBoard::send_message(const Message::Type command, const Fragment fragments[], const size_t count)
+{
+    size_t length{0};
+    for (size_t index{0}; index < count; ++index)
+    {
+        length += fragments[index].length;
+    }
+    Log.noticeln("Sending message: KISS command %X, %d characters", command, length);
+    if (!transmit_allowed(command))
+    {
+        return false;
+    }
+    return queue_frame(command, fragments, count);
+}
+
+/**
+ * @brief Check whether a message may be transmitted
+ *
+ * @param command KISS command byte
+ * @return true message may be sent
+ * @return false message suppressed
+ *
+ */
+
+bool RadioBoard::transmit_allowed(const Message::Type command) const
+{
     extern Antenna antenna;
 
     // supress message to ground if antenna deployment cycle not complete
@@ -256,14 +321,387 @@ bool RadioBoard::send_message(const Message message) const
         Log.warningln("Antenna deployment cycle not complete, remote message not sent");
         return false;
     }
+    return true;
+}
+
+/**
+ * @brief Wait for space in the transmit queue
+ *
+ * @param length bytes required
+ * @return true space available
+ * @return false timeout
+ *
+ * For commands which send more data than the transmit queue holds. While waiting, the
+ * other every pass tasks, including the watchdog, run and the processor sleeps between
+ * interrupts.
+ *
+ */
+
+bool RadioBoard::wait_for_transmit_space(const size_t length)
+{
+    extern TaskScheduler scheduler;
+    unsigned long wait_start{millis()};
+    while ((m_transmit_buffer.capacity() - m_transmit_buffer.available()) < length)
+    {
+        if ((millis() - wait_start) > transmit_space_timeout)
+        {
+            Log.errorln("Timeout waiting for radio transmit queue");
+            return false;
+        }
+        scheduler.yield();
+        __WFI(); // the transmit interrupt frees space
+    }
+    return true;
+}
+
+/**
+ * @brief Record latency of frames which have been transmitted
+ *
+ */
+
+void RadioBoard::check_transmit()
+{
+    while (m_transmit_record_count > 0)
+    {
+        auto &record{m_transmit_records[m_transmit_record_first]};
+        if (static_cast<int32_t>(m_bytes_transmitted - record.end_count) < 0)
+        {
+            break;
+        }
+        auto latency{millis() - record.queued_time};
+        ++m_transmit_latency_count;
+        m_transmit_latency_total += latency;
+        if (latency > m_transmit_latency_maximum)
+        {
+            m_transmit_latency_maximum = latency;
+        }
+        m_transmit_record_first = (m_transmit_record_first + 1) % radio_transmit_record_limit;
+        --m_transmit_record_count;
+    }
+}
+
+/**
+ * @brief Check for received characters not yet decoded
+ *
+ * @return true characters waiting in the receive buffer
+ * @return false receive buffer empty
+ *
+ */
+
+bool RadioBoard::receive_pending() const
+{
+    return m_receive_buffer.available() > 0;
+}
+
+/**
+ * @brief Add a KISS frame to the transmit queue
+ *
+ * @param command KISS command byte
+ * @param fragments frame content in order
+ * @param count number of fragments
+ * @return true frame queued
+ * @return false insufficient space, frame not queued
+ *
+ * The frame is escaped as it is copied into the queue and only becomes visible
+ * to the transmit interrupt once it is complete
+ *
+ */
+
+bool RadioBoard::queue_frame(const byte command, const Fragment fragments[], const size_t count)
+{
+    if (!kiss_stage_frame(m_transmit_buffer, command, fragments, count))
+    {
+        m_transmit_buffer.discard();
+        ++m_statistics.frames_rejected;
+        Log.warningln("Radio transmit queue full, message not sent (%l rejected)", m_statistics.frames_rejected);
+        return false;
+    }
+    m_bytes_queued += m_transmit_buffer.commit();
+    ++m_statistics.frames_queued;
+    if (m_transmit_record_count < radio_transmit_record_limit)
+    {
+        auto &record{m_transmit_records[(m_transmit_record_first + m_transmit_record_count) % radio_transmit_record_limit]};
+        record.end_count = m_bytes_queued;
+        record.queued_time = millis();
+        ++m_transmit_record_count;
+    }
+    if (!m_transmit_held)
+    {
+        PERIPH_SERIAL1.enableDataRegisterEmptyInterruptUART();
+    }
+    return true;
+}
 
-    Serial1.write(FEND);
-    Serial1.write(command);
-    Serial1.write(content.c_str());
-    Serial1.write(FEND);
+/**
+ * @brief Propose a new serial link speed to the Radio Board
+ *
+ * @param baud_rate requested speed
+ * @return true negotiation started
+ * @return false unsupported speed or negotiation in progress
+ *
+ * The Radio Board accepts the speed with a local response at the current speed. Both ends
+ * then switch and the Avionics Board repeats the proposal as a probe, which the Radio Board
+ * confirms at the new speed. If either response does not arrive, or framing errors
+ * accumulate at the new speed, both ends return to the initial speed.
+ *
+ */
+
+bool RadioBoard::propose_baud_rate(const uint32_t baud_rate)
+{
+    if (!supported_baud_rate(baud_rate) || m_baud_rate_state != BaudRateState::idle)
+    {
+        Log.errorln("Baud rate %l not proposed", baud_rate);
+        return false;
+    }
+    if (baud_rate == m_baud_rate)
+    {
+        Log.verboseln("Radio link already at %l baud", baud_rate);
+        return true;
+    }
+    Log.noticeln("Proposing radio link baud rate %l", baud_rate);
+    Message message(Message::modify_baud_rate, String(baud_rate));
+    if (!message.send())
+    {
+        return false;
+    }
+    m_proposed_baud_rate = baud_rate;
+    m_baud_rate_timer = millis();
+    m_baud_rate_state = BaudRateState::proposed;
     return true;
 }
 
+/**
+ * @brief Process a baud rate response from the Radio Board
+ *
+ * @param baud_rate speed in the response
+ *
+ */
+
+void RadioBoard::baud_rate_response(const uint32_t baud_rate)
+{
+    if (m_baud_rate_state == BaudRateState::proposed && baud_rate == m_proposed_baud_rate)
+    {
+        Log.verboseln("Radio Board accepted baud rate %l", baud_rate);
+        m_baud_rate_state = BaudRateState::draining;
+    }
+    else if (m_baud_rate_state == BaudRateState::probing && baud_rate == m_baud_rate)
+    {
+        Log.noticeln("Radio link confirmed at %l baud", baud_rate);
+        m_baud_rate_framing_errors = m_framing_errors;
+        m_baud_rate_timer = millis();
+        m_baud_rate_state = BaudRateState::idle;
+    }
+    else
+    {
+        Log.warningln("Unexpected baud rate response %l, ignored", baud_rate);
+    }
+}
+
+/**
+ * @brief Advance baud rate negotiation and check link quality
+ *
+ */
+
+void RadioBoard::check_baud_rate()
+{
+    switch (m_baud_rate_state)
+    {
+    case BaudRateState::idle:
+        if (m_baud_rate != serial1_baud_rate && (millis() - m_baud_rate_timer) > baud_rate_check_interval)
+        {
+            if ((m_framing_errors - m_baud_rate_framing_errors) >= baud_rate_framing_error_limit)
+            {
+                Log.errorln("Radio link framing errors at %l baud", m_baud_rate);
+                fall_back_baud_rate();
+            }
+            m_baud_rate_framing_errors = m_framing_errors;
+            m_baud_rate_timer = millis();
+        }
+        break;
+    case BaudRateState::proposed:
+        if ((millis() - m_baud_rate_timer) > baud_rate_response_timeout)
+        {
+            Log.errorln("Radio Board did not accept baud rate %l", m_proposed_baud_rate);
+            m_baud_rate_state = BaudRateState::idle;
+        }
+        break;
+    case BaudRateState::draining:
+        if (transmit_complete())
+        {
+            set_baud_rate(m_proposed_baud_rate);
+            m_baud_rate_framing_errors = m_framing_errors;
+            m_baud_rate_timer = millis();
+            m_baud_rate_state = BaudRateState::probing;
+            Message message(Message::modify_baud_rate, String(m_baud_rate));
+            message.send();
+        }
+        break;
+    case BaudRateState::probing:
+        if ((m_framing_errors - m_baud_rate_framing_errors) >= baud_rate_framing_error_limit ||
+            (millis() - m_baud_rate_timer) > baud_rate_response_timeout)
+        {
+            Log.errorln("Radio Board did not confirm baud rate %l", m_baud_rate);
+            fall_back_baud_rate();
+            m_baud_rate_state = BaudRateState::idle;
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Check whether every queued character has left the UART
+ *
+ * @return true transmit queue empty and the last character shifted out
+ * @return false characters remain
+ *
+ * An empty data register only means the last character has moved to the shift
+ * register, so the transmit complete flag is checked as well. The transmit interrupt
+ * clears the flag as it writes each character.
+ *
+ */
+
+bool RadioBoard::transmit_complete() const
+{
+    return m_transmit_buffer.available() == 0 && (SERCOM_SERIAL1->USART.INTFLAG.reg & SERCOM_USART_INTFLAG_TXC) != 0;
+}
+
+/**
+ * @brief Get the serial link speed
+ *
+ * @return uint32_t current speed
+ *
+ */
+
+uint32_t RadioBoard::get_baud_rate() const
+{
+    return m_baud_rate;
+}
+
+/**
+ * @brief Check whether the Radio Board supports a speed
+ *
+ * @param baud_rate speed to check
+ * @return true supported
+ * @return false not supported
+ *
+ */
+
+bool RadioBoard::supported_baud_rate(const uint32_t baud_rate)
+{
+    for (auto supported : radio_baud_rates)
+    {
+        if (baud_rate == supported)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Change the Serial1 speed
+ *
+ * @param baud_rate new speed
+ *
+ */
+
+void RadioBoard::set_baud_rate(const uint32_t baud_rate)
+{
+    Serial1.end();
+    Serial1.begin(baud_rate);
+    m_baud_rate = baud_rate;
+    if (m_transmit_buffer.available() > 0)
+    {
+        PERIPH_SERIAL1.enableDataRegisterEmptyInterruptUART();
+    }
+}
+
+/**
+ * @brief Return to the initial speed
+ *
+ */
+
+void RadioBoard::fall_back_baud_rate()
+{
+    ++m_statistics.baud_rate_fallbacks;
+    Log.warningln("Radio link returning to %l baud (%l fallbacks)", serial1_baud_rate, m_statistics.baud_rate_fallbacks);
+    set_baud_rate(serial1_baud_rate);
+}
+
+/**
+ * @brief Get the radio link counters
+ *
+ * @return LinkStatistics current counters
+ *
+ * Rates cover the interval since the previous call
+ *
+ */
+
+LinkStatistics RadioBoard::get_link_statistics()
+{
+    auto statistics{m_statistics};
+    statistics.bytes_received = m_bytes_received;
+    statistics.bytes_transmitted = m_bytes_transmitted;
+    statistics.framing_errors = m_framing_errors;
+    statistics.hardware_overruns = m_hardware_overruns;
+    statistics.receive_overflows = m_receive_buffer.overflows();
+    statistics.outside_frame = m_decoder.outside_frame_errors();
+    statistics.escape_errors = m_decoder.escape_errors();
+    statistics.frames_aborted = m_decoder.aborted_frames();
+    statistics.overlength_characters = m_decoder.overflow_errors();
+    statistics.baud_rate = m_baud_rate;
+    auto now{millis()};
+    auto interval{now - m_statistics_time};
+    if (interval > 0)
+    {
+        statistics.receive_rate = static_cast<uint32_t>(static_cast<uint64_t>(statistics.bytes_received - m_statistics_bytes_received) * seconds_to_milliseconds / interval);
+        statistics.transmit_rate = static_cast<uint32_t>(static_cast<uint64_t>(statistics.bytes_transmitted - m_statistics_bytes_transmitted) * seconds_to_milliseconds / interval);
+    }
+    m_statistics_time = now;
+    m_statistics_bytes_received = statistics.bytes_received;
+    m_statistics_bytes_transmitted = statistics.bytes_transmitted;
+    return statistics;
+}
+
+/**
+ * @brief Get the radio link counters for a response
+ *
+ * @return const String counters in LinkStatistics order, hexadecimal
+ *
+ */
+
+const String RadioBoard::get_link_detail()
+{
+    auto statistics{get_link_statistics()};
+    const uint32_t counters[]{
+        statistics.bytes_received,
+        statistics.bytes_transmitted,
+        statistics.receive_rate,
+        statistics.transmit_rate,
+        statistics.frames_received,
+        statistics.frames_processed,
+        statistics.frames_dropped,
+        statistics.frames_queued,
+        statistics.frames_rejected,
+        statistics.framing_errors,
+        statistics.hardware_overruns,
+        statistics.receive_overflows,
+        statistics.outside_frame,
+        statistics.escape_errors,
+        statistics.frames_aborted,
+        statistics.overlength_characters,
+        statistics.baud_rate_fallbacks,
+        statistics.baud_rate,
+    };
+    static_assert(sizeof(counters) == sizeof(LinkStatistics), "Link detail does not report all counters");
+    String detail{};
+    for (auto counter : counters)
+    {
+        detail += " " + String(counter, HEX);
+    }
+    return detail;
+}
+
 /**
  * @brief Check for recent ground contact
  *
@@ -278,78 +716,164 @@ bool RadioBoard::recent_ground_contact() const
 }
 
 /**
- * @brief Start new frame
+ * @brief Add the decoded frame to the queue
+ *
+ * @param length characters in frame including type
  *
  */
 
-void RadioBoard::start_frame()
+void RadioBoard::commit_frame(const size_t length)
 {
-    m_in_frame = true;
-    m_buffer_index = 0;
+    auto &slot{decoding_slot()};
+    slot.signature_valid = m_verifying && m_verifier.finish();
+    slot.sequence = m_verifying ? m_verifier.get_sequence() : 0;
+    slot.signature_length = m_verifying ? m_verifier.get_signature_length() : 0;
+    m_verified_length = 0;
+    ++m_statistics.frames_received;
+    if (m_frame_count >= radio_frame_queue_size)
+    {
+        ++m_statistics.frames_dropped;
+        Log.errorln("Radio frame queue full, frame ignored");
+        return;
+    }
+    slot.length = length;
+    slot.data[length] = '\0';
+    ++m_frame_count;
 }
 
 /**
- * @brief End frame
+ * @brief Pass newly decoded characters of a ground command to the signature verifier
+ *
+ * @param slot slot receiving the frame being decoded
+ * @param decoded characters decoded so far including type
  *
  */
 
-void RadioBoard::end_frame()
+void RadioBoard::verify_frame(const FrameSlot &slot, const size_t decoded)
 {
-    m_in_frame = false;
+    if (decoded < m_verified_length)
+    {
+        m_verified_length = 0; // frame discarded, a new frame follows
+    }
+    if (decoded <= m_verified_length)
+    {
+        return;
+    }
+    auto start{m_verified_length};
+    if (start == 0)
+    {
+        auto type{static_cast<byte>(slot.data[0])};
+        m_verifying = type == REMOTE_FRAME || type == REMOTE_BINARY_FRAME;
+        if (m_verifying)
+        {
+            m_verifier.start(type == REMOTE_BINARY_FRAME);
+        }
+        start = 1; // type is not signed
+    }
+    if (m_verifying && decoded > start)
+    {
+        m_verifier.update(slot.data + start, decoded - start);
+    }
+    m_verified_length = decoded;
 }
 
 /**
- * @brief Enter escape mode
+ * @brief Slot receiving the frame being decoded
+ *
+ * @return FrameSlot& slot following the queued frames
  *
  */
 
-void RadioBoard::enter_escape_mode()
+RadioBoard::FrameSlot &RadioBoard::decoding_slot()
 {
-    m_received_escape = true;
+    return m_frames[(m_frame_first + m_frame_count) % (radio_frame_queue_size + 1)];
 }
 
 /**
- * @brief Exit escape mode
+ * @brief Record ground contact
  *
  */
 
-void RadioBoard::exit_escape_mode()
+void RadioBoard::ground_contact()
 {
-    m_received_escape = false;
+    m_milliseconds_since_last_ground_contact_day = millis();
+    m_days_since_last_ground_contact = 0;
 }
 
 /**
- * @brief Add character to buffer
+ * @brief Service the Serial1 SERCOM
  *
- * @param character character to add
- * @return true character added
- * @return false error
+ * @note called from the Serial1 interrupt handler
  *
  */
 
-bool RadioBoard::add_character_to_buffer(char character)
+void RadioBoard::serial_interrupt()
 {
-    if (m_buffer_index < maximum_command_length)
+    receive_interrupt();
+    transmit_interrupt();
+    if (PERIPH_SERIAL1.isUARTError())
     {
-        m_buffer[m_buffer_index++] = character;
-        return true;
+        if (PERIPH_SERIAL1.isBufferOverflowErrorUART())
+        {
+            m_hardware_overruns = m_hardware_overruns + 1;
+        }
+        PERIPH_SERIAL1.acknowledgeUARTError();
+        PERIPH_SERIAL1.clearStatusUART();
     }
-    else
+}
+
+/**
+ * @brief Move received characters into the receive buffer
+ *
+ */
+
+void RadioBoard::receive_interrupt()
+{
+    if (PERIPH_SERIAL1.isFrameErrorUART())
     {
-        Log.errorln("Overflow character in radio frame: %X, ignored", character);
-        return false;
+        PERIPH_SERIAL1.readDataUART(); // discard character with framing error
+        PERIPH_SERIAL1.clearFrameErrorUART();
+        m_framing_errors = m_framing_errors + 1;
+    }
+    while (PERIPH_SERIAL1.availableDataUART())
+    {
+        m_receive_buffer.push(PERIPH_SERIAL1.readDataUART());
+        m_bytes_received = m_bytes_received + 1;
     }
 }
 
 /**
- * @brief Record ground contact
+ * @brief Move the next queued character to the transmitter
+ *
+ * The data register empty interrupt is enabled while the transmit queue has data. Until
+ * the Radio Board has had time to initialize only the abort transaction is sent; frames
+ * queued meanwhile stay in the queue until check_radio() releases them.
  *
  */
 
-void RadioBoard::ground_contact()
+void RadioBoard::transmit_interrupt()
 {
-    m_milliseconds_since_last_ground_contact_day = millis();
-    m_days_since_last_ground_contact = 0;
+    if (!PERIPH_SERIAL1.isDataRegisterEmptyUART())
+    {
+        return;
+    }
+    if (m_transmit_held && m_bytes_transmitted == m_transmit_hold_count)
+    {
+        PERIPH_SERIAL1.disableDataRegisterEmptyInterruptUART();
+        return;
+    }
+    const uint8_t *data{};
+    if (m_transmit_buffer.peek(data) > 0)
+    {
+        SERCOM_SERIAL1->USART.INTFLAG.reg = SERCOM_USART_INTFLAG_TXC; // set again once this character has been sent
+        PERIPH_SERIAL1.writeDataUART(*data);
+        m_transmit_buffer.consume(1);
+        m_bytes_transmitted = m_bytes_transmitted + 1;
+    }
+    if (m_transmit_buffer.available() == 0)
+    {
+        PERIPH_SERIAL1.disableDataRegisterEmptyInterruptUART();
+    }
 }
 
 /**
@@ -410,6 +934,20 @@ bool RadioBoard::get_frequency()
 bool RadioBoard::test_radio()
 {
     Log.noticeln("Testing Radio Board");
+    auto statistics{get_link_statistics()};
+    Log.verboseln("Radio receive buffer high water mark %d of %d bytes, %l bytes lost to overflow, %l framing errors, %l hardware overruns",
+                  m_receive_buffer.high_water_mark(), m_receive_buffer.capacity(), statistics.receive_overflows, statistics.framing_errors, statistics.hardware_overruns);
+    Log.verboseln("Radio transmit queue depth %d, high water mark %d of %d bytes, %l frames queued, %l rejected",
+                  m_transmit_buffer.available(), m_transmit_buffer.high_water_mark(), m_transmit_buffer.capacity(), statistics.frames_queued, statistics.frames_rejected);
+    Log.verboseln("Radio frames received %l, dropped %l, processed %l", statistics.frames_received, statistics.frames_dropped, statistics.frames_processed);
+    Log.verboseln("Radio KISS errors: %l outside frame, %l invalid escapes, %l frames aborted, %l characters over length",
+                  statistics.outside_frame, statistics.escape_errors, statistics.frames_aborted, statistics.overlength_characters);
+    Log.verboseln("Radio link %l baud, %l fallbacks", statistics.baud_rate, statistics.baud_rate_fallbacks);
+    if (m_transmit_latency_count > 0)
+    {
+        Log.verboseln("Radio transmit latency mean %l ms, maximum %l ms",
+                      m_transmit_latency_total / m_transmit_latency_count, m_transmit_latency_maximum);
+    }
     Message message(Message::get_status, "");
     message.send();
     return true;
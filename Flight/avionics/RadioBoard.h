@@ -9,17 +9,67 @@
 #pragma once
 
 #include "avionics_constants.h"
+#include "KissDecoder.h"
+#include "KissEncoder.h"
 #include "Message.h"
+#include "RingBuffer.h"
+#include "SignatureVerifier.h"
+
+/**
+ * @brief Radio Board constants
+ *
+ */
+
+constexpr size_t radio_receive_buffer_size{512};   /**< receive buffer depth, power of two @hideinitializer */
+constexpr size_t radio_transmit_buffer_size{1024}; /**< transmit queue depth, power of two @hideinitializer */
+constexpr size_t radio_transmit_record_limit{16};  /**< queued frames tracked for latency @hideinitializer */
+constexpr size_t radio_frame_queue_size{4};        /**< received frames awaiting processing @hideinitializer */
 
 /**
  * @brief Frame data and length
  *
+ * The command refers to the received frame in the Radio Board frame queue and
+ * remains valid until the frame is released
+ *
  */
 
 struct Frame
 {
     byte type{};
-    String command{};
+    char *command{};           /**< content following the type, zero terminated, may be tokenized in place */
+    size_t length{};           /**< characters in content */
+    bool signature_valid{};    /**< ground command signature verified while receiving */
+    long sequence{};           /**< ground command sequence number */
+    size_t signature_length{}; /**< characters preceding the ground command text */
+};
+
+/**
+ * @brief Radio link counters
+ *
+ * Reported in this order by the GetLinkStats command
+ *
+ */
+
+struct LinkStatistics
+{
+    uint32_t bytes_received{};        /**< characters read from Serial1 */
+    uint32_t bytes_transmitted{};     /**< characters written to Serial1 */
+    uint32_t receive_rate{};          /**< bytes per second received since previous report */
+    uint32_t transmit_rate{};         /**< bytes per second transmitted since previous report */
+    uint32_t frames_received{};       /**< frames decoded */
+    uint32_t frames_processed{};      /**< frames released after processing */
+    uint32_t frames_dropped{};        /**< frames lost because the frame queue was full */
+    uint32_t frames_queued{};         /**< frames added to the transmit queue */
+    uint32_t frames_rejected{};       /**< frames not sent because the transmit queue was full */
+    uint32_t framing_errors{};        /**< characters received with UART framing errors */
+    uint32_t hardware_overruns{};     /**< UART receive overruns */
+    uint32_t receive_overflows{};     /**< characters lost because the receive buffer was full */
+    uint32_t outside_frame{};         /**< characters received outside a frame */
+    uint32_t escape_errors{};         /**< invalid characters following FESC */
+    uint32_t frames_aborted{};        /**< frames aborted by FESC followed by FESC or FEND */
+    uint32_t overlength_characters{}; /**< characters beyond the maximum command length */
+    uint32_t baud_rate_fallbacks{};   /**< returns to the initial serial link speed */
+    uint32_t baud_rate{};             /**< current serial link speed */
 };
 
 /**
@@ -30,23 +80,125 @@ class RadioBoard final
 {
 public:
     bool begin();
-    bool receive_frame();
+    bool check_radio();
+    size_t receive_frames();
     Frame get_frame();
-    bool send_message(const Message message) const;
+    void release_frame();
+    bool send_message(const Message message);
+    bool send_message(const Message::Type command, const Fragment fragments[], const size_t count);
+    bool wait_for_transmit_space(const size_t length);
+    void check_transmit();
+    bool receive_pending() const;
+    bool propose_baud_rate(const uint32_t baud_rate);
+    void baud_rate_response(const uint32_t baud_rate);
+    void check_baud_rate();
+    uint32_t get_baud_rate() const;
+    static bool supported_baud_rate(const uint32_t baud_rate);
+    LinkStatistics get_link_statistics();
+    const String get_link_detail();
     bool recent_ground_contact() const;
     bool test_radio();
+    void serial_interrupt();
 private:
-    void start_frame();
-    void end_frame();
-    void enter_escape_mode();
-    void exit_escape_mode();
-    bool add_character_to_buffer(char character);
+    /**
+     * @brief Radio Board startup states
+     *
+     */
+
+    enum class RadioStartupState
+    {
+        startup,        /**< begin() not called */
+        waiting,        /**< abort sent, Radio Board initializing */
+        probing,        /**< invalid command sent, collecting response */
+        ready,          /**< Radio Board responded */
+        not_responding, /**< no response to probe */
+    };
+
+    /**
+     * @brief Baud rate negotiation states
+     *
+     */
+
+    enum class BaudRateState
+    {
+        idle,     /**< no negotiation in progress */
+        proposed, /**< new rate sent, awaiting Radio Board acceptance */
+        draining, /**< accepted, waiting for the last character to be sent */
+        probing,  /**< switched, awaiting probe response at new rate */
+    };
+
+    /**
+     * @brief Queued frame awaiting transmission
+     *
+     */
+
+    struct TransmitRecord
+    {
+        uint32_t end_count{};        /**< bytes queued when frame was added */
+        unsigned long queued_time{}; /**< time frame was added */
+    };
+
+    /**
+     * @brief Received frame
+     *
+     */
+
+    struct FrameSlot
+    {
+        size_t length{};                          /**< characters in frame including type */
+        char data[maximum_command_length + 1]{}; /**< type, content, and terminator */
+        bool signature_valid{};                   /**< ground command signature valid */
+        long sequence{};                          /**< ground command sequence number */
+        size_t signature_length{};                /**< characters preceding the ground command text */
+    };
+
+    void receive_interrupt();
+    void transmit_interrupt();
+    bool transmit_allowed(const Message::Type command) const;
+    bool queue_frame(const byte command, const Fragment fragments[], const size_t count);
+    void commit_frame(const size_t length);
+    FrameSlot &decoding_slot();
+    void verify_frame(const FrameSlot &slot, const size_t decoded);
+    void set_baud_rate(const uint32_t baud_rate);
+    bool transmit_complete() const;
+    void fall_back_baud_rate();
     void ground_contact();
     bool get_frequency();
-    size_t m_buffer_index{0};
-    char m_buffer[maximum_command_length+1]{""};
-    bool m_in_frame{false};
-    bool m_received_escape{false};
+    RingBuffer<radio_receive_buffer_size> m_receive_buffer{};
+    volatile uint32_t m_bytes_received{0};
+    volatile uint32_t m_framing_errors{0};
+    volatile uint32_t m_hardware_overruns{0};
+    RingBuffer<radio_transmit_buffer_size> m_transmit_buffer{};
+    volatile uint32_t m_bytes_transmitted{0};
+    volatile bool m_transmit_held{false};     // transmit interrupt stops at m_transmit_hold_count during startup
+    volatile uint32_t m_transmit_hold_count{0}; // characters which may be sent while held
+    uint32_t m_bytes_queued{0};
+    LinkStatistics m_statistics{}; // counters maintained outside the interrupt handler
+    unsigned long m_statistics_time{0};
+    uint32_t m_statistics_bytes_received{0};
+    uint32_t m_statistics_bytes_transmitted{0};
+    TransmitRecord m_transmit_records[radio_transmit_record_limit]{};
+    size_t m_transmit_record_first{0};
+    size_t m_transmit_record_count{0};
+    uint32_t m_transmit_latency_count{0};
+    unsigned long m_transmit_latency_total{0};
+    unsigned long m_transmit_latency_maximum{0};
+    FrameSlot m_frames[radio_frame_queue_size + 1]{}; // one slot more than the queue holds for the frame being decoded
+    size_t m_frame_first{0};
+    size_t m_frame_count{0};
+    KissDecoder m_decoder{};
+    SignatureVerifier m_verifier{};
+    size_t m_verified_length{0};
+    bool m_verifying{false};
+    RadioStartupState m_startup_state{RadioStartupState::startup};
+    unsigned long m_startup_state_start_time{0};
+    uint32_t m_probe_bytes_received{0};
+    uint32_t m_probe_frames_received{0};
+    uint32_t m_baud_rate{0};
+    BaudRateState m_baud_rate_state{BaudRateState::idle};
+    uint32_t m_proposed_baud_rate{0};
+    unsigned long m_baud_rate_timer{0};
+    uint32_t m_baud_rate_framing_errors{0}; // framing errors when the current check started
     unsigned long m_milliseconds_since_last_ground_contact_day{0};
     long m_days_since_last_ground_contact{0};
 };
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat response packer
+ *
+ * This file implements the class which packs the records of a list response into
+ * as few frames as possible
+ *
+ */
+
+#include "ResponsePacker.h"
+#include "RadioBoard.h"
+#include "Response.h"
+#include "log_utility.h"
+
+/**
+ * @brief Add a record to the response
+ *
+ * @param record record text
+ * @param length characters in record, truncated to the radio response limit
+ * @return true successful
+ * @return false error sending a full frame
+ *
+ */
+
+bool ResponsePacker::add(const char *record, size_t length)
+{
+    if (length > radio_response_limit)
+    {
+        Log.warningln("Response record truncated");
+        length = radio_response_limit;
+    }
+    if (m_length > 0 && m_length + 1 + length > radio_response_limit)
+    {
+        send(false);
+    }
+    if (m_length > 0)
+    {
+        m_records[m_length++] = record_separator;
+    }
+    memcpy(m_records + m_length, record, length);
+    m_length += length;
+    return m_status;
+}
+
+/**
+ * @brief Send the last frame of the response
+ *
+ * @return true successful
+ * @return false error sending a frame
+ *
+ */
+
+bool ResponsePacker::finish()
+{
+    return send(true);
+}
+
+/**
+ * @brief Format a time for a record
+ *
+ * @param time time to format
+ * @param compact format as eight hexadecimal digits of seconds since 1970 rather than ISO 8601
+ * @param[out] buffer at least packed_time_limit characters
+ * @return size_t characters formatted, not including the terminator
+ *
+ */
+
+size_t ResponsePacker::format_time(const DateTime &time, const bool compact, char *buffer)
+{
+    int length{};
+    if (compact)
+    {
+        length = snprintf(buffer, packed_time_limit, "%08lx", static_cast<unsigned long>(time.unixtime()));
+    }
+    else
+    {
+        length = snprintf(buffer, packed_time_limit, "%04u-%02u-%02uT%02u:%02u:%02u",
+                          time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second());
+    }
+    return length < 0 ? 0 : static_cast<size_t>(length) < packed_time_limit ? static_cast<size_t>(length) : packed_time_limit - 1;
+}
+
+/**
+ * @brief Send the records packed so far
+ *
+ * @param last no records follow this frame
+ * @return true all frames sent
+ * @return false error
+ *
+ */
+
+bool ResponsePacker::send(const bool last)
+{
+    m_records[m_length] = '\0';
+    String content{m_type};
+    if (!last)
+    {
+        content += continuation_marker;
+    }
+    if (m_length > 0)
+    {
+        content += ' ';
+        content += m_records;
+    }
+    if (!Message::collecting())
+    {
+        extern RadioBoard radio;
+        // transmit queue may hold fewer frames than the response; Response prefixes "RES "
+        radio.wait_for_transmit_space(kiss_encoded_limit(RES.length() + 1 + content.length()));
+    }
+    Response response{content};
+    m_status = response.send() && m_status;
+    m_length = 0;
+    return m_status;
+}
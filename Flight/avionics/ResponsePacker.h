@@ -0,0 +1,42 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat response packer
+ *
+ * This file declares the class which packs the records of a list response into
+ * as few frames as possible
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+#include "RTClib.h"
+
+constexpr size_t packed_time_limit{20};  /**< characters in a formatted time, including the terminator @hideinitializer */
+constexpr char record_separator{';'};    /**< separates records within a frame @hideinitializer */
+constexpr char continuation_marker{'+'}; /**< follows the response type when more frames follow @hideinitializer */
+
+/**
+ * @brief Pack list records into response frames
+ *
+ * Records are separated by semicolons and each frame holds as many whole records as
+ * fit within the radio response limit. Every frame but the last has a plus sign
+ * after the response type, for example "RES GPQ+ 0 ...;1 ..." followed by "RES GPQ 2 ...".
+ *
+ */
+
+class ResponsePacker final
+{
+public:
+    explicit ResponsePacker(const char *type) : m_type{type} {}
+    bool add(const char *record, size_t length);
+    bool finish();
+    static size_t format_time(const DateTime &time, const bool compact, char *buffer);
+
+private:
+    bool send(const bool last);
+    const char *m_type;                         // response type, for example GPQ
+    char m_records[radio_response_limit + 1]{}; // records for the current frame and terminator
+    size_t m_length{0};                         // characters in m_records
+    bool m_status{true};                        // all frames sent
+};
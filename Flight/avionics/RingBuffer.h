@@ -0,0 +1,193 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat ring buffer
+ *
+ * This file declares and implements the fixed size byte queue shared between an
+ * interrupt handler and the process loop. One side only adds data and the other side
+ * only removes it, so no locking is required.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Single producer, single consumer ring buffer
+ *
+ * @tparam Size capacity in bytes, must be a power of two
+ *
+ */
+
+template <size_t Size>
+class RingBuffer final
+{
+    static_assert(Size > 0 && (Size & (Size - 1)) == 0, "Ring buffer size must be a power of two");
+
+public:
+    /**
+     * @brief Add a byte to the buffer
+     *
+     * @param value byte to add
+     * @return true successful
+     * @return false buffer full, byte discarded and overflow counted
+     *
+     */
+
+    bool push(const uint8_t value)
+    {
+        auto head{m_head};
+        auto used{head - m_tail};
+        if (used >= Size)
+        {
+            ++m_overflows;
+            return false;
+        }
+        m_data[head & mask] = value;
+        barrier();
+        m_head = head + 1;
+        if (used + 1 > m_high_water_mark)
+        {
+            m_high_water_mark = used + 1;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Add a byte to the buffer without making it available to the consumer
+     *
+     * @param value byte to add
+     * @return true successful
+     * @return false buffer full, staged bytes must be discarded
+     *
+     * Staged bytes become available together when committed.
+     *
+     */
+
+    bool stage(const uint8_t value)
+    {
+        auto head{m_head + m_staged};
+        if (head - m_tail >= Size)
+        {
+            return false;
+        }
+        m_data[head & mask] = value;
+        ++m_staged;
+        return true;
+    }
+
+    /**
+     * @brief Make staged bytes available to the consumer
+     *
+     * @return size_t number of bytes committed
+     *
+     */
+
+    size_t commit()
+    {
+        auto staged{m_staged};
+        barrier();
+        m_head = m_head + staged;
+        m_staged = 0;
+        auto used{m_head - m_tail};
+        if (used > m_high_water_mark)
+        {
+            m_high_water_mark = used;
+        }
+        return staged;
+    }
+
+    /**
+     * @brief Discard staged bytes
+     *
+     */
+
+    void discard() { m_staged = 0; }
+
+    /**
+     * @brief Get the contiguous data at the front of the buffer without removing it
+     *
+     * @param[out] data start of the data
+     * @return size_t number of contiguous bytes available
+     *
+     * Call again after consume() to reach data which wraps around the end of the storage.
+     *
+     */
+
+    size_t peek(const uint8_t *&data) const
+    {
+        auto tail{m_tail};
+        auto used{m_head - tail};
+        barrier();
+        auto offset{tail & mask};
+        auto contiguous{Size - offset};
+        data = &m_data[offset];
+        return used < contiguous ? used : contiguous;
+    }
+
+    /**
+     * @brief Remove bytes from the front of the buffer
+     *
+     * @param length number of bytes to remove, no more than available()
+     *
+     */
+
+    void consume(const size_t length)
+    {
+        barrier();
+        m_tail = m_tail + length;
+    }
+
+    /**
+     * @brief Number of bytes in the buffer
+     *
+     */
+
+    size_t available() const { return m_head - m_tail; }
+
+    /**
+     * @brief Capacity of the buffer
+     *
+     */
+
+    static constexpr size_t capacity() { return Size; }
+
+    /**
+     * @brief Largest number of bytes held at one time
+     *
+     */
+
+    size_t high_water_mark() const { return m_high_water_mark; }
+
+    /**
+     * @brief Number of bytes discarded because the buffer was full
+     *
+     */
+
+    uint32_t overflows() const { return m_overflows; }
+
+    /**
+     * @brief Discard the contents of the buffer
+     *
+     */
+
+    void clear() { m_tail = m_head; }
+
+private:
+    static constexpr size_t mask{Size - 1};
+
+    /**
+     * @brief Prevent the compiler from moving data accesses across index updates
+     *
+     */
+
+    static void barrier() { __asm__ __volatile__("" ::: "memory"); }
+
+    volatile size_t m_head{0};            /**< free running count of bytes added */
+    volatile size_t m_tail{0};            /**< free running count of bytes removed */
+    volatile size_t m_high_water_mark{0}; /**< largest number of bytes held */
+    volatile uint32_t m_overflows{0};     /**< bytes discarded because buffer full */
+    size_t m_staged{0};                   /**< bytes added but not yet committed */
+    uint8_t m_data[Size]{};
+};
@@ -0,0 +1,250 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat ground command signature verification
+ *
+ * This file implements the class that verifies the signature of a ground command
+ * while the command is being received
+ *
+ */
+
+#include "SignatureVerifier.h"
+#include "arduino_secrets.h"
+
+namespace
+{
+    const byte secret[]{SECRET_HASH_KEY};            /**< HMAC key */
+    constexpr size_t hmac_block_length{64};          /**< BLAKE2s block length @hideinitializer */
+    constexpr byte hmac_pad_difference{0x36 ^ 0x5C}; /**< inner pad applied by resetHMAC() to outer pad @hideinitializer */
+    static_assert(sizeof(secret) <= hmac_block_length, "HMAC key longer than a BLAKE2s block");
+
+    /**
+     * @brief Value of a hexadecimal digit
+     *
+     * @param character digit
+     * @return int value, or -1 if not a hexadecimal digit
+     *
+     */
+
+    int hex_value(const char character)
+    {
+        if (character >= '0' && character <= '9')
+            return character - '0';
+        if (character >= 'A' && character <= 'F')
+            return character - 'A' + 10;
+        if (character >= 'a' && character <= 'f')
+            return character - 'a' + 10;
+        return -1;
+    }
+}
+
+/**
+ * @brief Compute the keyed HMAC states
+ *
+ * resetHMAC() applies the inner pad to the key, so the outer state is computed
+ * from the zero padded key combined with the difference between the pads
+ *
+ */
+
+void SignatureVerifier::begin()
+{
+    m_inner_key.resetHMAC(secret, sizeof(secret));
+    byte outer_key[hmac_block_length]{};
+    for (size_t index{0}; index < hmac_block_length; ++index)
+    {
+        outer_key[index] = static_cast<byte>((index < sizeof(secret) ? secret[index] : 0) ^ hmac_pad_difference);
+    }
+    m_outer_key.resetHMAC(outer_key, hmac_block_length);
+    memset(outer_key, 0, sizeof(outer_key));
+}
+
+/**
+ * @brief Start verifying a new command
+ *
+ * @param binary command uses the binary signature format
+ *
+ */
+
+void SignatureVerifier::start(const bool binary)
+{
+    m_binary = binary;
+    m_received = 0;
+    m_sequence = 0;
+    m_valid_hex = true;
+    m_sequence_digits = true;
+    memset(m_hmac, 0, sizeof(m_hmac));
+    memset(m_salt, 0, sizeof(m_salt));
+}
+
+/**
+ * @brief Add received command characters
+ *
+ * @param data characters following those already received
+ * @param length number of characters
+ *
+ */
+
+void SignatureVerifier::update(const char *data, const size_t length)
+{
+    size_t index{0};
+
+    // HMAC, salt, and sequence are handled a character at a time
+
+    while (index < length && m_received < get_signature_length())
+    {
+        if (m_binary)
+        {
+            update_binary_signature(data[index++]);
+        }
+        else
+        {
+            update_signature(data[index++]);
+        }
+    }
+
+    // Command text is hashed in one call
+
+    if (index < length)
+    {
+        m_blake.update(data + index, length - index);
+        m_received += length - index;
+    }
+}
+
+/**
+ * @brief Complete verification at the end of the frame
+ *
+ * @return true signature valid
+ * @return false signature invalid or command too short
+ *
+ */
+
+bool SignatureVerifier::finish()
+{
+    if (m_received < get_signature_length() || !m_valid_hex)
+    {
+        return false;
+    }
+    byte inner_hash[hmac_length]{};
+    m_blake.finalize(inner_hash, hmac_length);
+    m_blake = m_outer_key;
+    m_blake.update(inner_hash, hmac_length);
+    byte computed_hmac[hmac_length]{};
+    m_blake.finalize(computed_hmac, hmac_length);
+
+    // compare every byte so that timing does not reveal the matching prefix
+
+    byte difference{0};
+    for (size_t index{0}; index < hmac_length; ++index)
+    {
+        difference |= computed_hmac[index] ^ m_hmac[index];
+    }
+    return difference == 0;
+}
+
+/**
+ * @brief Get the command sequence number
+ *
+ * @return long sequence number received, zero if not received
+ *
+ */
+
+long SignatureVerifier::get_sequence() const
+{
+    return m_sequence;
+}
+
+/**
+ * @brief Get the length of the signature preceding the command text
+ *
+ * @return size_t signature length for the current format
+ *
+ */
+
+size_t SignatureVerifier::get_signature_length() const
+{
+    return m_binary ? signature_length_binary : signature_length_hex_ascii;
+}
+
+/**
+ * @brief Start the HMAC once the salt is known
+ *
+ */
+
+void SignatureVerifier::start_hmac()
+{
+    m_blake = m_inner_key;
+    m_blake.update(m_salt, salt_length);
+}
+
+/**
+ * @brief Process one character of the text signature
+ *
+ * @param character received character
+ *
+ */
+
+void SignatureVerifier::update_signature(const char character)
+{
+    auto position{m_received++};
+    if (position < hmac_length_hex_ascii + salt_length_hex_ascii)
+    {
+        auto value{hex_value(character)};
+        if (value < 0)
+        {
+            m_valid_hex = false;
+            return;
+        }
+        auto shift{(position % 2) == 0 ? 4 : 0};
+        if (position < hmac_length_hex_ascii)
+        {
+            m_hmac[position / 2] |= static_cast<byte>(value << shift);
+        }
+        else
+        {
+            m_salt[(position - hmac_length_hex_ascii) / 2] |= static_cast<byte>(value << shift);
+        }
+        if (m_received == hmac_length_hex_ascii + salt_length_hex_ascii)
+        {
+            start_hmac();
+        }
+        return;
+    }
+    if (m_sequence_digits && isdigit(character))
+    {
+        m_sequence = m_sequence * 10 + (character - '0');
+    }
+    else
+    {
+        m_sequence_digits = false;
+    }
+    m_blake.update(&character, 1);
+}
+
+/**
+ * @brief Process one byte of the binary signature
+ *
+ * @param character received byte
+ *
+ */
+
+void SignatureVerifier::update_binary_signature(const char character)
+{
+    auto position{m_received++};
+    auto value{static_cast<byte>(character)};
+    if (position < hmac_length)
+    {
+        m_hmac[position] = value;
+        return;
+    }
+    if (position < hmac_length + salt_length)
+    {
+        m_salt[position - hmac_length] = value;
+        if (m_received == hmac_length + salt_length)
+        {
+            start_hmac();
+        }
+        return;
+    }
+    m_sequence = static_cast<long>((static_cast<uint32_t>(m_sequence) << 8) | value);
+    m_blake.update(&value, 1);
+}
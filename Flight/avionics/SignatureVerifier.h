@@ -0,0 +1,62 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat ground command signature verification
+ *
+ * This file declares the class that verifies the signature of a ground command
+ * while the command is being received
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+#include "BLAKE2s.h"
+
+// Command signature constants
+
+constexpr size_t hmac_length{32};                                                                                     /**< HMAC length in bytes @hideinitializer */
+constexpr size_t hmac_length_hex_ascii{hmac_length * 2};                                                              /**< HMAC length as hex characters @hideinitializer */
+constexpr size_t salt_length{8};                                                                                      /**< Salt length in bytes @hideinitializer */
+constexpr size_t salt_length_hex_ascii{salt_length * 2};                                                              /**< Salt length as hex characters @hideinitializer */
+constexpr size_t sequence_length{4};                                                                                  /**< Sequence length in bytes @hideinitializer */
+constexpr size_t sequence_length_hex_ascii{sequence_length * 2};                                                      /**< Sequence length as characters @hideinitializer */
+constexpr size_t signature_length_hex_ascii{hmac_length_hex_ascii + salt_length_hex_ascii + sequence_length_hex_ascii}; /**< Signature length as hex ascii @hideinitializer */
+constexpr size_t signature_length_binary{hmac_length + salt_length + sequence_length};                                  /**< Signature length as bytes @hideinitializer */
+
+/**
+ * @brief Incremental ground command signature verifier
+ *
+ * The signed command is the HMAC, the salt, the sequence, and the command text. In the
+ * text format the HMAC and salt are hex and the sequence is decimal; in the binary format
+ * they are bytes and the sequence is big endian. The HMAC and salt are decoded as they
+ * arrive, and the sequence and command are hashed as they arrive, so little work remains
+ * at the end of the frame.
+ * The keyed HMAC states are computed once and copied for each command.
+ *
+ */
+
+class SignatureVerifier final
+{
+public:
+    void begin();
+    void start(const bool binary);
+    void update(const char *data, const size_t length);
+    bool finish();
+    long get_sequence() const;
+    size_t get_signature_length() const;
+
+private:
+    void update_signature(const char character);
+    void update_binary_signature(const char character);
+    void start_hmac();
+    BLAKE2s m_inner_key{}; // HMAC state after the inner key block
+    BLAKE2s m_outer_key{}; // HMAC state after the outer key block
+    BLAKE2s m_blake{};
+    byte m_hmac[hmac_length]{};
+    byte m_salt[salt_length]{};
+    size_t m_received{0}; // characters received following the frame type
+    long m_sequence{0};
+    bool m_binary{false};         // binary signature format
+    bool m_valid_hex{true};       // HMAC and salt contain only hexadecimal digits
+    bool m_sequence_digits{true}; // no character other than a digit in sequence yet
+};
@@ -0,0 +1,50 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat sorted name tables
+ *
+ * This file declares and implements the binary search of a table sorted by name, used
+ * to look up ground commands in the command table
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Find a name in a table sorted by name
+ *
+ * @tparam Entry table entry type
+ * @param entries table in ascending strcmp() order of name
+ * @param count number of entries
+ * @param name name to find, zero terminated
+ * @param field member of Entry holding the name
+ * @return size_t index of the entry, count if not found
+ *
+ */
+
+template <typename Entry>
+size_t find_name(const Entry entries[], const size_t count, const char *name, const char *const Entry::*field)
+{
+    size_t lower{0};
+    size_t upper{count};
+    while (lower < upper)
+    {
+        auto middle{lower + (upper - lower) / 2};
+        auto comparison{strcmp(name, entries[middle].*field)};
+        if (comparison < 0)
+        {
+            upper = middle;
+        }
+        else if (comparison > 0)
+        {
+            lower = middle + 1;
+        }
+        else
+        {
+            return middle;
+        }
+    }
+    return count;
+}
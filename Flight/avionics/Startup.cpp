@@ -0,0 +1,146 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat startup sequence
+ *
+ * This file implements the state machine which steps the Avionics Board through its boot
+ * phases from the process loop and records when each phase was reached
+ *
+ */
+
+#include "Startup.h"
+#include "log_utility.h"
+
+/**
+ * @brief Start the serial delay
+ *
+ */
+
+void Startup::begin()
+{
+    enter(BootPhase::serial_delay);
+}
+
+/**
+ * @brief Advance the startup sequence
+ *
+ * Called on every pass of the process loop
+ *
+ */
+
+void Startup::step()
+{
+    auto elapsed{millis() - m_phase_times[static_cast<size_t>(m_phase)]};
+    switch (m_phase)
+    {
+    case BootPhase::serial_delay:
+        if (elapsed >= serial_delay)
+        {
+            enter(BootPhase::initializing);
+            m_initialize();
+            enter(BootPhase::test_delay);
+            Log.noticeln("Starting test delay");
+            Log.noticeln("Avionics process accepting commands, replies suppressed until antenna deployment");
+        }
+        break;
+    case BootPhase::initializing:
+        break;
+    case BootPhase::test_delay:
+        if (elapsed >= test_delay)
+        {
+            Log.noticeln("Test delay complete");
+            enter(BootPhase::testing);
+            Log.noticeln("Testing satellite components");
+        }
+        break;
+    case BootPhase::testing:
+        if (!m_test(m_test_index++))
+        {
+            enter(BootPhase::running);
+            Log.noticeln("Initial testing complete, Radio and Payload tests continue");
+        }
+        break;
+    case BootPhase::running:
+        break;
+    }
+}
+
+/**
+ * @brief Get the current boot phase
+ *
+ */
+
+BootPhase Startup::get_phase() const
+{
+    return m_phase;
+}
+
+/**
+ * @brief Check that the boards are initialized
+ *
+ * @return true process loop tasks may run
+ * @return false boards not initialized
+ *
+ */
+
+bool Startup::initialized() const
+{
+    return m_phase > BootPhase::initializing;
+}
+
+/**
+ * @brief Check that a phase has been reached
+ *
+ */
+
+bool Startup::phase_reached(const BootPhase phase) const
+{
+    return m_reached[static_cast<size_t>(phase)];
+}
+
+/**
+ * @brief Time a phase was reached
+ *
+ * @param phase boot phase
+ * @return unsigned long milliseconds since power on, zero if not reached
+ *
+ */
+
+unsigned long Startup::get_phase_time(const BootPhase phase) const
+{
+    return m_phase_times[static_cast<size_t>(phase)];
+}
+
+/**
+ * @brief Name of a boot phase for reports
+ *
+ */
+
+const char *Startup::phase_name(const BootPhase phase)
+{
+    switch (phase)
+    {
+    case BootPhase::serial_delay:
+        return "SerialDelay";
+    case BootPhase::initializing:
+        return "Initializing";
+    case BootPhase::test_delay:
+        return "TestDelay";
+    case BootPhase::testing:
+        return "Testing";
+    case BootPhase::running:
+        return "Running";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Enter a phase and record the time
+ *
+ */
+
+void Startup::enter(const BootPhase phase)
+{
+    m_phase = phase;
+    m_phase_times[static_cast<size_t>(phase)] = millis();
+    m_reached[static_cast<size_t>(phase)] = true;
+}
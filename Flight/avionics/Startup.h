@@ -0,0 +1,74 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat startup sequence
+ *
+ * This file declares the state machine which steps the Avionics Board through its boot
+ * phases from the process loop and records when each phase was reached
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+constexpr unsigned long serial_delay{2 * seconds_to_milliseconds};                     /**< wait for serial console @hideinitializer */
+constexpr unsigned long test_delay{30 * minutes_to_seconds * seconds_to_milliseconds}; /**< wait before testing components @hideinitializer */
+
+/**
+ * @brief Boot phases in order
+ *
+ */
+
+enum class BootPhase : uint8_t
+{
+    serial_delay, /**< waiting for the serial console, boards not initialized */
+    initializing, /**< initializing the boards */
+    test_delay,   /**< process loop running, waiting to test components */
+    testing,      /**< process loop running, testing one component on each pass */
+    running,      /**< startup complete */
+};
+
+constexpr size_t boot_phase_count{static_cast<size_t>(BootPhase::running) + 1}; /**< number of boot phases @hideinitializer */
+
+/**
+ * @brief Startup state machine
+ *
+ * Delays are timed phases rather than busy waits. Once the boards are initialized the
+ * process loop tasks run, so ground commands are received and executed during the test
+ * delay. Replies to the ground are still suppressed until the antenna deployment cycle
+ * completes, and the antenna separation delay starts only when startup completes, as it
+ * did when startup ran in setup(). Component tests run one on each pass so the watchdog
+ * is serviced between them.
+ *
+ */
+
+class Startup final
+{
+public:
+    /**
+     * @brief Construct a new Startup object
+     *
+     * @param initialize function to initialize the boards
+     * @param test function to run a component test, returns false when there are no more tests
+     *
+     */
+
+    Startup(void (*initialize)(), bool (*test)(const size_t index)) : m_initialize{initialize}, m_test{test} {}
+
+    void begin();
+    void step();
+    BootPhase get_phase() const;
+    bool initialized() const;
+    bool phase_reached(const BootPhase phase) const;
+    unsigned long get_phase_time(const BootPhase phase) const;
+    static const char *phase_name(const BootPhase phase);
+
+private:
+    void enter(const BootPhase phase);
+    void (*m_initialize)();                          // initialize the boards
+    bool (*m_test)(const size_t index);              // run a component test
+    BootPhase m_phase{BootPhase::serial_delay};      // current phase
+    size_t m_test_index{0};                          // next component test
+    unsigned long m_phase_times[boot_phase_count]{}; // milliseconds when each phase was reached
+    bool m_reached[boot_phase_count]{};              // phases reached
+};
@@ -0,0 +1,187 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat stored commands
+ *
+ * This file implements the class which holds time tagged ground commands until their
+ * execution time and keeps the results for later downlink
+ *
+ */
+
+#include "StoredCommands.h"
+#include "log_utility.h"
+
+/**
+ * @brief Store a command
+ *
+ * @param time execution time, seconds since 1970
+ * @param text command and arguments
+ * @param length characters in text
+ * @return true successful
+ * @return false store full or command too long
+ *
+ */
+
+bool StoredCommands::store(const uint32_t time, const char *text, const size_t length)
+{
+    if (m_size >= stored_command_limit)
+    {
+        Log.errorln("Stored command limit reached");
+        return false;
+    }
+    if (length >= stored_command_length)
+    {
+        Log.errorln("Stored command too long");
+        return false;
+    }
+
+    // insert after any commands with the same or an earlier time
+
+    auto index{m_size};
+    while (index > 0 && m_entries[index - 1].time > time)
+    {
+        m_entries[index] = m_entries[index - 1];
+        --index;
+    }
+    m_entries[index].time = time;
+    memcpy(m_entries[index].text, text, length);
+    m_entries[index].text[length] = '\0';
+    ++m_size;
+    return true;
+}
+
+/**
+ * @brief Get the execution time of the next command
+ *
+ * @return uint32_t seconds since 1970, zero if no command stored
+ *
+ */
+
+uint32_t StoredCommands::next_time() const
+{
+    return m_size > 0 ? m_entries[0].time : 0;
+}
+
+/**
+ * @brief Remove the next command
+ *
+ * @return Entry next command, the store must not be empty
+ *
+ */
+
+StoredCommands::Entry StoredCommands::take()
+{
+    auto entry{m_entries[0]};
+    for (size_t index{1}; index < m_size; ++index)
+    {
+        m_entries[index - 1] = m_entries[index];
+    }
+    --m_size;
+    return entry;
+}
+
+/**
+ * @brief Number of commands awaiting execution
+ *
+ */
+
+size_t StoredCommands::size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief Get a command awaiting execution
+ *
+ * @param index position in order of execution, less than size()
+ * @return const Entry& stored command
+ *
+ */
+
+const StoredCommands::Entry &StoredCommands::operator[](const size_t index) const
+{
+    return m_entries[index];
+}
+
+/**
+ * @brief Remove all commands awaiting execution
+ *
+ */
+
+void StoredCommands::clear()
+{
+    m_size = 0;
+}
+
+/**
+ * @brief Record the result of an executed command
+ *
+ * @param time execution time, seconds since 1970
+ * @param status command successful
+ * @param name command name
+ * @param responses collected responses, each preceded by a space
+ * @param length characters in responses
+ *
+ */
+
+void StoredCommands::record_result(const uint32_t time, const bool status, const char *name, const char *responses, const size_t length)
+{
+    if (m_result_count >= stored_result_limit)
+    {
+        m_result_start = (m_result_start + 1) % stored_result_limit;
+        --m_result_count;
+        ++m_results_lost;
+    }
+    auto &result{m_results[(m_result_start + m_result_count) % stored_result_limit]};
+    ++m_result_count;
+    result.time = time;
+    result.status = status;
+    auto name_length{strnlen(name, stored_result_length - 1)};
+    memcpy(result.text, name, name_length);
+    auto response_length{length < stored_result_length - 1 - name_length ? length : stored_result_length - 1 - name_length};
+    memcpy(result.text + name_length, responses, response_length);
+    result.text[name_length + response_length] = '\0';
+}
+
+/**
+ * @brief Number of results awaiting downlink
+ *
+ */
+
+size_t StoredCommands::result_count() const
+{
+    return m_result_count;
+}
+
+/**
+ * @brief Get a result
+ *
+ * @param index position in order of execution, less than result_count()
+ * @return const Result& command result
+ *
+ */
+
+const StoredCommands::Result &StoredCommands::result(const size_t index) const
+{
+    return m_results[(m_result_start + index) % stored_result_limit];
+}
+
+/**
+ * @brief Number of results replaced before downlink
+ *
+ */
+
+uint32_t StoredCommands::results_lost() const
+{
+    return m_results_lost;
+}
+
+/**
+ * @brief Remove all results
+ *
+ */
+
+void StoredCommands::clear_results()
+{
+    m_result_start = 0;
+    m_result_count = 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat stored commands
+ *
+ * This file declares the class which holds time tagged ground commands until their
+ * execution time and keeps the results for later downlink
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+constexpr size_t stored_command_limit{16};  /**< maximum commands awaiting execution @hideinitializer */
+constexpr size_t stored_command_length{64}; /**< maximum characters in a stored command, including the terminator @hideinitializer */
+constexpr size_t stored_result_limit{16};   /**< maximum results awaiting downlink @hideinitializer */
+constexpr size_t stored_result_length{48};  /**< maximum characters in a result, including the terminator @hideinitializer */
+
+/**
+ * @brief Time tagged command store
+ *
+ * Commands are kept in order of execution time, and commands with the same time
+ * keep the order in which they were stored. Results are kept in order of execution;
+ * when the result buffer is full the oldest result is replaced.
+ *
+ */
+
+class StoredCommands final
+{
+public:
+    /**
+     * @brief Command awaiting execution
+     *
+     */
+
+    struct Entry
+    {
+        uint32_t time;                    /**< execution time, seconds since 1970 */
+        char text[stored_command_length]; /**< command and arguments */
+    };
+
+    /**
+     * @brief Result of an executed command
+     *
+     */
+
+    struct Result
+    {
+        uint32_t time;                   /**< execution time, seconds since 1970 */
+        bool status;                     /**< command successful */
+        char text[stored_result_length]; /**< command name and responses */
+    };
+
+    bool store(const uint32_t time, const char *text, const size_t length);
+    uint32_t next_time() const;
+    Entry take();
+    size_t size() const;
+    const Entry &operator[](const size_t index) const;
+    void clear();
+    void record_result(const uint32_t time, const bool status, const char *name, const char *responses, const size_t length);
+    size_t result_count() const;
+    const Result &result(const size_t index) const;
+    uint32_t results_lost() const;
+    void clear_results();
+
+private:
+    Entry m_entries[stored_command_limit]{}; // commands in order of execution time
+    size_t m_size{0};                        // commands awaiting execution
+    Result m_results[stored_result_limit]{}; // circular buffer of results
+    size_t m_result_start{0};                // index of the oldest result
+    size_t m_result_count{0};                // results awaiting downlink
+    uint32_t m_results_lost{0};              // results replaced before downlink
+};
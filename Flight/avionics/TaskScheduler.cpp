@@ -0,0 +1,208 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat cooperative task scheduler
+ *
+ * This file implements the scheduler which runs the process loop tasks at their
+ * declared periods and counts deadline overruns
+ *
+ */
+
+#include "TaskScheduler.h"
+#include "Profiler.h"
+
+/**
+ * @brief Run one pass of the process loop
+ *
+ */
+
+void TaskScheduler::run()
+{
+    extern Profiler profiler;
+    auto pass_start{millis()};
+    if (!m_started)
+    {
+        for (size_t index{0}; index < m_count; ++index)
+        {
+            m_release[index] = pass_start;
+            auto stage{profiler.add_stage(m_tasks[index].name)};
+            if (index == 0)
+            {
+                m_first_stage = stage;
+            }
+        }
+        m_started = true;
+    }
+
+    // select the highest priority periodic task which is due
+
+    auto selected{m_count};
+    for (size_t index{0}; index < m_count && selected == m_count; ++index)
+    {
+        if (m_tasks[index].period != 0 && (m_pending[index] || static_cast<int32_t>(pass_start - m_release[index]) >= 0))
+        {
+            selected = index;
+        }
+    }
+
+    for (size_t index{0}; index < m_count; ++index)
+    {
+        const auto &task{m_tasks[index]};
+        if (task.period != 0 && index != selected)
+        {
+            continue;
+        }
+        auto release{task.period == 0 || static_cast<int32_t>(pass_start - m_release[index]) < 0 ? pass_start : m_release[index]};
+        m_pending[index] = false;
+        {
+            ScopedTimer timer{profiler, m_first_stage + index};
+            m_running = index;
+            task.run();
+            m_running = task_limit;
+        }
+        auto latency{millis() - release};
+        auto &statistics{m_statistics[index]};
+        ++statistics.runs;
+        if (latency > task.deadline)
+        {
+            ++statistics.overruns;
+        }
+        if (latency > statistics.worst_latency)
+        {
+            statistics.worst_latency = latency;
+        }
+        if (task.period != 0)
+        {
+            m_release[index] = latency > task.period ? release + latency + task.period : release + task.period;
+        }
+    }
+}
+
+/**
+ * @brief Run the every pass tasks other than the running task
+ *
+ * Called by a task waiting for something another task or an interrupt provides, such
+ * as transmit queue space, so that the watchdog and the Radio Board are still serviced.
+ * Periodic tasks wait for the next pass, and a yield from a yielded task does nothing.
+ *
+ */
+
+void TaskScheduler::yield()
+{
+    if (!m_started || m_yielding)
+    {
+        return;
+    }
+    m_yielding = true;
+    for (size_t index{0}; index < m_count; ++index)
+    {
+        if (m_tasks[index].period == 0 && index != m_running)
+        {
+            m_tasks[index].run();
+        }
+    }
+    m_yielding = false;
+}
+
+/**
+ * @brief Earliest release time of the periodic tasks
+ *
+ * @return uint32_t time in milliseconds, now if the tasks have not been released or a task
+ * is pending
+ *
+ */
+
+uint32_t TaskScheduler::next_release() const
+{
+    auto now{static_cast<uint32_t>(millis())};
+    if (!m_started)
+    {
+        return now;
+    }
+    auto earliest{now + UINT32_MAX / 2};
+    for (size_t index{0}; index < m_count; ++index)
+    {
+        if (m_tasks[index].period == 0)
+        {
+            continue;
+        }
+        if (m_pending[index])
+        {
+            return now;
+        }
+        if (static_cast<int32_t>(m_release[index] - earliest) < 0)
+        {
+            earliest = m_release[index];
+        }
+    }
+    return earliest;
+}
+
+/**
+ * @brief Release a periodic task now
+ *
+ * @param run task function
+ *
+ * @note may be called from an interrupt handler; sets only the pending flag, a single
+ * byte store, so it does not race the release time update in run()
+ *
+ */
+
+void TaskScheduler::release(void (*run)())
+{
+    for (size_t index{0}; index < m_count; ++index)
+    {
+        if (m_tasks[index].run == run)
+        {
+            m_pending[index] = true;
+        }
+    }
+}
+
+/**
+ * @brief Number of tasks
+ *
+ */
+
+size_t TaskScheduler::get_task_count() const
+{
+    return m_count;
+}
+
+/**
+ * @brief Get a task
+ *
+ * @param index position in the task table, less than get_task_count()
+ * @return const Task& task
+ *
+ */
+
+const Task &TaskScheduler::get_task(const size_t index) const
+{
+    return m_tasks[index];
+}
+
+/**
+ * @brief Get the statistics for a task
+ *
+ * @param index position in the task table, less than get_task_count()
+ * @return TaskStatistics runs, overruns, and worst latency
+ *
+ */
+
+TaskStatistics TaskScheduler::get_statistics(const size_t index) const
+{
+    return m_statistics[index];
+}
+
+/**
+ * @brief Reset the statistics for all tasks
+ *
+ */
+
+void TaskScheduler::clear_statistics()
+{
+    for (size_t index{0}; index < m_count; ++index)
+    {
+        m_statistics[index] = TaskStatistics{};
+    }
+}
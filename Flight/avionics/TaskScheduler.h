@@ -0,0 +1,105 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief SilverSat cooperative task scheduler
+ *
+ * This file declares the scheduler which runs the process loop tasks at their
+ * declared periods and counts deadline overruns
+ *
+ */
+
+#pragma once
+
+#include "avionics_constants.h"
+
+constexpr size_t task_limit{16}; /**< maximum tasks @hideinitializer */
+
+/**
+ * @brief Process loop task, kept in flash
+ *
+ */
+
+struct Task
+{
+    const char *name;  /**< name for reports */
+    void (*run)();     /**< task function */
+    uint32_t period;   /**< milliseconds between releases, zero to run on every pass */
+    uint32_t deadline; /**< milliseconds from release to completion */
+    uint8_t priority;  /**< lower values run first */
+};
+
+/**
+ * @brief Task statistics
+ *
+ */
+
+struct TaskStatistics
+{
+    uint32_t runs;          /**< times run */
+    uint32_t overruns;      /**< times completed after the deadline */
+    uint32_t worst_latency; /**< longest milliseconds from release to completion */
+};
+
+/**
+ * @brief Check the task table order at compile time
+ *
+ * @return true tasks in priority order
+ *
+ */
+
+constexpr bool tasks_in_priority_order(const Task *tasks, const size_t count)
+{
+    return count < 2 || (tasks[0].priority <= tasks[1].priority && tasks_in_priority_order(tasks + 1, count - 1));
+}
+
+/**
+ * @brief Cooperative task scheduler
+ *
+ * Tasks with a zero period run on every pass. Of the periodic tasks which are due,
+ * only the one with the highest priority runs on each pass, so a pass takes no longer
+ * than the every pass tasks and the longest periodic task. A periodic task is released
+ * again one period after its previous release, or one period after it runs if it fell
+ * more than a period behind. Each task is also measured as a profiler stage.
+ *
+ * An interrupt handler releases a task by setting its pending flag, which only run()
+ * clears, just before the task runs, so a release arriving while the scheduler updates
+ * the release times is not lost.
+ *
+ */
+
+class TaskScheduler final
+{
+public:
+    /**
+     * @brief Construct a new Task Scheduler object
+     *
+     * @tparam Count number of tasks
+     * @param tasks tasks in priority order
+     *
+     */
+
+    template <size_t Count>
+    explicit TaskScheduler(const Task (&tasks)[Count]) : m_tasks{tasks}, m_count{Count}
+    {
+        static_assert(Count <= task_limit, "Too many tasks");
+    }
+
+    void run();
+    void yield();
+    uint32_t next_release() const;
+    void release(void (*run)());
+    size_t get_task_count() const;
+    const Task &get_task(const size_t index) const;
+    TaskStatistics get_statistics(const size_t index) const;
+    void clear_statistics();
+
+private:
+    const Task *m_tasks;                       // task table
+    size_t m_count;                            // number of tasks
+    uint32_t m_release[task_limit]{};          // next release time of each task in milliseconds
+    volatile bool m_pending[task_limit]{};     // task released by an interrupt handler
+    TaskStatistics m_statistics[task_limit]{}; // statistics for each task
+    size_t m_first_stage{0};                   // profiler stage of the first task
+    size_t m_running{task_limit};              // index of the task running, task_limit between tasks
+    bool m_yielding{false};                    // other tasks running on behalf of a waiting task
+    bool m_started{false};                     // tasks released
+};
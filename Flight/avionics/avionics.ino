@@ -28,12 +28,14 @@
 #include "RadioBoard.h"
 #include "PayloadBoard.h"
 #include "CommandProcessor.h"
+#include "TaskScheduler.h"
+#include "Profiler.h"
+#include "IdleManager.h"
+#include "Startup.h"
 
 // Avionics loop constants
 
 constexpr uint32_t serial_baud_rate{19200}; /**< speed of serial connection @hideinitializer */
-constexpr unsigned long serial_delay{2 * seconds_to_milliseconds};
-constexpr unsigned long test_delay{30 * minutes_to_seconds * seconds_to_milliseconds};
 
 // Create the boards, antenna, and command processor
 
@@ -43,22 +45,111 @@ RadioBoard radio{};
 PayloadBoard payload{};
 Antenna antenna{};
 CommandProcessor command_processor{};
+Profiler profiler{};
+IdleManager idle_manager{};
 
 /**
- * @brief Arduino setup function to initialize the boards and devices and test them
+ * @brief Process loop tasks
  *
  */
 
-void setup()
+void watchdog_task() { avionics.service_watchdog(); }
+void radio_startup_task() { radio.check_radio(); }
+void command_task() { command_processor.check_for_command(); }
+void transmit_task() { radio.check_transmit(); }
+void baud_rate_task() { radio.check_baud_rate(); }
+void payload_shutdown_task() { payload.check_shutdown(); }
+
+// The separation delay starts once startup completes, after the test delay and component tests
+
+void antenna_task()
 {
-  // Initialize logging and the boards
+  extern Startup startup;
+  if (startup.phase_reached(BootPhase::running))
+  {
+    antenna.check_antenna();
+  }
+}
 
-  Serial.begin(serial_baud_rate);
-  unsigned long serial_delay_start{millis()};
-  while ((millis() - serial_delay_start) < serial_delay)
+void stability_task() { avionics.get_stability(); }
+void beacon_task() { avionics.check_beacon(); }
+void stored_command_task() { command_processor.check_stored_commands(); }
+void payload_time_task() { avionics.check_payload(); }
+void log_day_task() { updateLogDay(); }
+
+// Watchdog and radio tasks run on every pass, I2C reads at a few hertz or less
+
+constexpr Task tasks[]{
+  {"Watchdog", watchdog_task, 0, 100, 0},
+  {"RadioStartup", radio_startup_task, 0, 100, 1},
+  {"Commands", command_task, 0, 100, 1},
+  {"Transmit", transmit_task, 0, 100, 1},
+  {"BaudRate", baud_rate_task, 0, 100, 1},
+  {"PayloadShutdown", payload_shutdown_task, 50, 50, 2},
+  {"Antenna", antenna_task, 100, 100, 3},
+  {"Stability", stability_task, 200, 200, 4},
+  {"Beacon", beacon_task, 1000, 1000, 5},
+  {"StoredCommands", stored_command_task, 1000, 1000, 5},
+  {"PayloadTime", payload_time_task, 1000, 1000, 5},
+  {"LogDay", log_day_task, 1000, 1000, 6},
+};
+static_assert(tasks_in_priority_order(tasks, sizeof(tasks) / sizeof(tasks[0])), "Tasks must be in priority order");
+
+TaskScheduler scheduler{tasks};
+
+// Payload shutdown and overcurrent pins wake the processor and release the shutdown check.
+// In the avionics_board variant SHUTDOWN_A is on EXTINT 2 and PAYLOAD_OC on EXTINT 9, while
+// SHUTDOWN_B and SHUTDOWN_C have no external interrupt and rely on the 50 ms poll.
+
+constexpr unsigned payload_wake_pins[]{SHUTDOWN_A, SHUTDOWN_B, SHUTDOWN_C, PAYLOAD_OC};
+
+void payload_pin_interrupt() { scheduler.release(payload_shutdown_task); }
+
+/**
+ * @brief Attach the payload pin interrupts
+ *
+ * A pin is attached only if the variant pin table gives it an external interrupt line
+ * which no earlier pin uses, since attaching a second pin to a line replaces the first
+ * pin's configuration. Other pins are left to the periodic shutdown check.
+ *
+ */
+
+void attach_payload_interrupts()
+{
+  int attached[sizeof(payload_wake_pins) / sizeof(payload_wake_pins[0])]{};
+  size_t attached_count{0};
+  for (auto pin : payload_wake_pins)
   {
-    avionics.service_watchdog(); // service the watchdog while waiting for the serial port
+    auto line{static_cast<int>(g_APinDescription[pin].ulExtInt)};
+    if (line == NOT_AN_INTERRUPT || line == EXTERNAL_INT_NMI)
+    {
+      Log.noticeln("Payload pin %u has no external interrupt, polled", pin);
+      continue;
+    }
+    auto shared{false};
+    for (size_t index{0}; index < attached_count; ++index)
+    {
+      shared = shared || attached[index] == line;
+    }
+    if (shared)
+    {
+      Log.errorln("Payload pin %u shares external interrupt %d, polled", pin, line);
+      continue;
+    }
+    attachInterrupt(digitalPinToInterrupt(pin), payload_pin_interrupt, CHANGE);
+    attached[attached_count++] = line;
   }
+}
+
+/**
+ * @brief Initialize logging and the boards
+ *
+ * Called by the startup sequence after the serial delay
+ *
+ */
+
+void initialize_boards()
+{
   Log.setPrefix(printPrefix);
   Log.setSuffix(printSuffix);
   Log.begin(LOG_LEVEL_VERBOSE, &Serial);
@@ -91,7 +182,7 @@ void setup()
   Log.noticeln("Initializing Radio Board interface");
   if (radio.begin())
   {
-    Log.noticeln("Radio Board interface initialization completed");
+    Log.noticeln("Radio Board interface initialization started");
   }
   else
   {
@@ -101,6 +192,7 @@ void setup()
   Log.noticeln("Initializing Payload Board interface");
   if (payload.begin())
   {
+    attach_payload_interrupts();
     Log.noticeln("Payload Board interface initialization completed");
   }
   else
@@ -119,44 +211,71 @@ void setup()
   }
   
   Log.noticeln("Setup complete");
+  idle_manager.restart_duty_cycle();
+}
 
-  // Test delay
+/**
+ * @brief Test one of the devices or boards
+ *
+ * @param index test to run
+ * @return true test run
+ * @return false no more tests
+ *
+ * Called by the startup sequence on each pass after the test delay
+ *
+ */
 
-  Log.noticeln("Starting test delay");
-  unsigned long test_delay_start{millis()};
-  while ((millis() - test_delay_start) < test_delay)
+bool test_component(const size_t index)
+{
+  switch (index)
   {
-    avionics.service_watchdog(); // service the watchdog during the test delay
+  case 0:
+    Log.noticeln("Verifying external realtime clock status");
+    avionics.test_external_rtc();
+    break;
+  case 1:
+    Log.noticeln("Testing IMU");
+    avionics.test_IMU();
+    break;
+  case 2:
+    Log.noticeln("Testing FRAM");
+    avionics.test_FRAM();
+    break;
+  case 3:
+    Log.noticeln("Testing EPS-I");
+    power.test_EPS();
+    break;
+  case 4:
+    Log.noticeln("Testing Radio");
+    radio.test_radio();
+    break;
+  case 5:
+    Log.noticeln("Testing Payload");
+    payload.photo();
+    break;
+  case 6:
+    Log.noticeln("Testing Antenna");
+    antenna.test_antenna();
+    break;
+  default:
+    return false;
   }
-  Log.noticeln("Test delay complete");
-  Log.noticeln("Avionics process accepting commands");
-
-  // Testing: test the devices and the boards
-
-  Log.noticeln("Testing satellite components");
-
-  Log.noticeln("Verifying external realtime clock status");
-  avionics.test_external_rtc();
-
-  Log.noticeln("Testing IMU");
-  avionics.test_IMU();
-
-  Log.noticeln("Testing FRAM");
-  avionics.test_FRAM();
-
-  Log.noticeln("Testing EPS-I");
-  power.test_EPS();
-
-  Log.noticeln("Testing Radio");
-  radio.test_radio();
+  return true;
+}
 
-  Log.noticeln("Testing Payload");
-  payload.photo();
+Startup startup{initialize_boards, test_component};
 
-  Log.noticeln("Testing Antenna");
-  antenna.test_antenna();
+/**
+ * @brief Arduino setup function to start the serial port and the startup sequence
+ *
+ * The remaining startup steps run from the process loop
+ *
+ */
 
-  Log.noticeln("Initial testing complete, Radio and Payload tests continue");
+void setup()
+{
+  Serial.begin(serial_baud_rate);
+  startup.begin();
 }
 
 /**
@@ -166,12 +285,16 @@ void setup()
 
 void loop()
 {
-  updateLogDay();
-  avionics.service_watchdog();
-  antenna.check_antenna();
-  avionics.get_stability();
-  avionics.check_beacon();
-  command_processor.check_for_command();
-  avionics.check_payload();
-  payload.check_shutdown();
+  static const auto pass_stage{profiler.add_stage("Pass")};
+  startup.step();
+  if (startup.initialized())
+  {
+    ScopedTimer timer{profiler, pass_stage};
+    scheduler.run();
+  }
+  else
+  {
+    avionics.service_watchdog(); // service the watchdog while waiting for the serial port
+  }
+  idle_manager.sleep();
 }
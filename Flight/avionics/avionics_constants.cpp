@@ -0,0 +1,33 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Global String constants for Avionics Board
+ *
+ * This file defines the String constants declared in avionics_constants.h. They are
+ * defined once here rather than in the header, where each translation unit would
+ * construct its own copies and allocate their heap buffers at startup.
+ *
+ */
+
+#include "avionics_constants.h"
+
+// Local message content
+
+const String ACK{"ACK"};
+const String NACK{"NACK"};
+const String RES{"RES"};
+
+// SilverSat defined KISS local command types as characters
+
+const String LOCAL_FRAME_CHAR{"0"};
+const String REMOTE_FRAME_CHAR{"A"};
+const String BEACON_CHAR{"7"};
+const String DIGITALIO_RELEASE_CHAR{"8"};
+const String GET_RADIO_STATUS_CHAR{"9"};
+const String HALT_CHAR{"A"};
+const String MODIFY_FREQUENCY_CHAR{"B"};
+const String MODIFY_MODE_CHAR{"C"};
+const String TOGGLE_RADIO_5V_CHAR{"F"};
+const String BACKGROUND_RSSI_CHAR{"18"};
+const String CURRENT_RSSI_CHAR{"19"};
+const String MODIFY_BAUD_RATE_CHAR{"1C"};
+const String MODIFY_CCA_CHAR{"1F"};
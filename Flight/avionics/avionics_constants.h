@@ -16,11 +16,12 @@
  *
  */
 
-constexpr unsigned long seconds_to_milliseconds{1000}; /**< conversion factor for time in seconds @hideinitializer */
-constexpr unsigned long minutes_to_seconds{60};        /**< conversion factor for time in minutes @hideinitializer */
-constexpr unsigned long hours_to_minutes{60};          /**< conversion factor for time in hours @hideinitializer */
-constexpr unsigned long days_to_hours{24};             /**< conversion factor for time in days @hideinitializer */
-constexpr unsigned long weeks_to_days{7};              /**< conversion factor for time in weeks @hideinitializer */
+constexpr unsigned long milliseconds_to_microseconds{1000}; /**< conversion factor for time in milliseconds @hideinitializer */
+constexpr unsigned long seconds_to_milliseconds{1000};      /**< conversion factor for time in seconds @hideinitializer */
+constexpr unsigned long minutes_to_seconds{60};             /**< conversion factor for time in minutes @hideinitializer */
+constexpr unsigned long hours_to_minutes{60};               /**< conversion factor for time in hours @hideinitializer */
+constexpr unsigned long days_to_hours{24};                  /**< conversion factor for time in days @hideinitializer */
+constexpr unsigned long weeks_to_days{7};                   /**< conversion factor for time in weeks @hideinitializer */
 
 /**
  * @brief SAMD21 pin definitions
@@ -70,6 +71,7 @@ constexpr unsigned wait_for_i2c_device{20}; /**< wait for I2C device to become a
  */
 
 constexpr size_t maximum_command_length{256}; /**< maximum characters in command */
+constexpr size_t radio_response_limit{191};   /**< Radio response limit, does not include 'RES GRS ' */
 
 /**
  * @brief KISS protocol constants
@@ -86,9 +88,9 @@ constexpr byte TFESC{'\xDD'}; /**< transposed frame escape */
  *
  */
 
-const String ACK{"ACK"};   /**< acknowledge */
-const String NACK{"NACK"}; /**< negative acknowledge */
-const String RES{"RES"};   /**< response */
+extern const String ACK;  /**< acknowledge */
+extern const String NACK; /**< negative acknowledge */
+extern const String RES;  /**< response */
 
 /**
  * @brief SilverSat defined KISS local command types
@@ -97,6 +99,7 @@ const String RES{"RES"};   /**< response */
 
 constexpr byte LOCAL_FRAME{'\x00'};       /**< local data frame */
 constexpr byte REMOTE_FRAME{'\xAA'};      /**< remote data frame */
+constexpr byte REMOTE_BINARY_FRAME{'\xAB'}; /**< remote data frame with binary signature, requires Radio Board forwarding, see README */
 constexpr byte BEACON{'\x07'};            /**< beacon */
 constexpr byte DIGITALIO_RELEASE{'\x08'}; /**< deploy antenna in recovery mode */
 constexpr byte GET_RADIO_STATUS{'\x09'};  /**< request radio status */
@@ -106,6 +109,7 @@ constexpr byte MODIFY_MODE{'\x0C'};       /**< change radio mode */
 constexpr byte TOGGLE_RADIO_5V{'\x0F'};   /**< Toggle radio 5v */
 constexpr byte BACKGROUND_RSSI{'\x18'};   /**< background RSSI */
 constexpr byte CURRENT_RSSI{'\x19'};      /**< current RSSI */
+constexpr byte MODIFY_BAUD_RATE{'\x1C'};  /**< change serial link speed */
 constexpr byte MODIFY_CCA{'\x1F'};        /**< modify CCA threshold */
 
 /**
@@ -113,18 +117,19 @@ constexpr byte MODIFY_CCA{'\x1F'};        /**< modify CCA threshold */
  *
  */
 
-const String LOCAL_FRAME_CHAR{"0"};       /**< local data frame */
-const String REMOTE_FRAME_CHAR{"A"};      /**< remote data frame */
-const String BEACON_CHAR{"7"};            /**< beacon */
-const String DIGITALIO_RELEASE_CHAR{"8"}; /**< deploy antenna in recovery mode */
-const String GET_RADIO_STATUS_CHAR{"9"};  /**< request radio status */
-const String HALT_CHAR{"A"};              /**< stop transmission */
-const String MODIFY_FREQUENCY_CHAR{"B"};  /**< change radio frequency */
-const String MODIFY_MODE_CHAR{"C"};       /**< change radio mode */
-const String TOGGLE_RADIO_5V_CHAR{"F"};   /**< Toggle radio 5v */
-const String BACKGROUND_RSSI_CHAR{"18"};  /**< background RSSI */
-const String CURRENT_RSSI_CHAR{"19"};     /**< current RSSI */
-const String MODIFY_CCA_CHAR{"1F"};       /**< modify CCA threshold */
+extern const String LOCAL_FRAME_CHAR;       /**< local data frame */
+extern const String REMOTE_FRAME_CHAR;      /**< remote data frame */
+extern const String BEACON_CHAR;            /**< beacon */
+extern const String DIGITALIO_RELEASE_CHAR; /**< deploy antenna in recovery mode */
+extern const String GET_RADIO_STATUS_CHAR;  /**< request radio status */
+extern const String HALT_CHAR;              /**< stop transmission */
+extern const String MODIFY_FREQUENCY_CHAR;  /**< change radio frequency */
+extern const String MODIFY_MODE_CHAR;       /**< change radio mode */
+extern const String TOGGLE_RADIO_5V_CHAR;   /**< Toggle radio 5v */
+extern const String BACKGROUND_RSSI_CHAR;   /**< background RSSI */
+extern const String CURRENT_RSSI_CHAR;      /**< current RSSI */
+extern const String MODIFY_BAUD_RATE_CHAR;  /**< change serial link speed */
+extern const String MODIFY_CCA_CHAR;        /**< modify CCA threshold */
 
 /**
  * @brief Radio test command
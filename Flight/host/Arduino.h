@@ -0,0 +1,30 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host build stand-in for Arduino.h
+ *
+ * This file declares only what avionics_constants.h and the Arduino independent
+ * avionics components need, so that they can be tested and benchmarked on a host
+ *
+ */
+
+#pragma once
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+
+/**
+ * @brief Placeholder for the String constants in avionics_constants.h
+ *
+ */
+
+class String
+{
+public:
+    String(const char *) {}
+};
@@ -0,0 +1,138 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host model of the Arduino String allocation behaviour
+ *
+ * This file declares and implements the subset of the Arduino String used by the code
+ * paths the benchmarks compare against. It allocates as WString.cpp in the SAMD core
+ * does: every string, including an empty one, owns a heap buffer sized exactly to its
+ * length; concatenation reallocates to the new length; copying allocates unless the
+ * destination already has the capacity; substring() returns a new string; moving into a
+ * string copies into its buffer when it fits and otherwise takes the source buffer.
+ *
+ */
+
+#pragma once
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+class ArduinoString final
+{
+public:
+    ArduinoString(const char *text = "") { copy(text, strlen(text)); }
+    ArduinoString(const ArduinoString &other) { copy(other.m_buffer, other.m_length); }
+    ArduinoString(ArduinoString &&other) { move(other); }
+    ~ArduinoString() { free(m_buffer); }
+
+    ArduinoString &operator=(const ArduinoString &other)
+    {
+        if (this != &other)
+        {
+            copy(other.m_buffer, other.m_length);
+        }
+        return *this;
+    }
+
+    ArduinoString &operator=(ArduinoString &&other)
+    {
+        if (this != &other)
+        {
+            move(other);
+        }
+        return *this;
+    }
+
+    ArduinoString &operator=(const char *text)
+    {
+        copy(text, strlen(text));
+        return *this;
+    }
+
+    void concat(const char *text, const size_t length)
+    {
+        reserve(m_length + length);
+        memcpy(m_buffer + m_length, text, length);
+        m_length += length;
+        m_buffer[m_length] = '\0';
+    }
+
+    void trim()
+    {
+        size_t begin{0};
+        while (begin < m_length && isspace(m_buffer[begin]))
+        {
+            ++begin;
+        }
+        auto end{m_length};
+        while (end > begin && isspace(m_buffer[end - 1]))
+        {
+            --end;
+        }
+        m_length = end - begin;
+        memmove(m_buffer, m_buffer + begin, m_length);
+        m_buffer[m_length] = '\0';
+    }
+
+    int indexOf(const char character) const
+    {
+        auto found{static_cast<const char *>(memchr(m_buffer, character, m_length))};
+        return found == nullptr ? -1 : static_cast<int>(found - m_buffer);
+    }
+
+    ArduinoString substring(const size_t left, const size_t right) const
+    {
+        ArduinoString result{};
+        auto end{right < m_length ? right : m_length};
+        if (left < end)
+        {
+            result.copy(m_buffer + left, end - left);
+        }
+        return result;
+    }
+
+    ArduinoString substring(const size_t left) const { return substring(left, m_length); }
+
+    const char *c_str() const { return m_buffer; }
+    size_t length() const { return m_length; }
+
+private:
+    void reserve(const size_t length)
+    {
+        if (m_buffer != nullptr && m_capacity >= length)
+        {
+            return;
+        }
+        m_buffer = static_cast<char *>(realloc(m_buffer, length + 1));
+        m_capacity = length;
+    }
+
+    void copy(const char *text, const size_t length)
+    {
+        reserve(length);
+        memmove(m_buffer, text, length);
+        m_length = length;
+        m_buffer[m_length] = '\0';
+    }
+
+    void move(ArduinoString &other)
+    {
+        if (m_buffer != nullptr && m_capacity >= other.m_length)
+        {
+            memcpy(m_buffer, other.m_buffer, other.m_length + 1);
+            m_length = other.m_length;
+            return;
+        }
+        free(m_buffer);
+        m_buffer = other.m_buffer;
+        m_capacity = other.m_capacity;
+        m_length = other.m_length;
+        other.m_buffer = nullptr;
+        other.m_capacity = 0;
+        other.m_length = 0;
+    }
+
+    char *m_buffer{nullptr}; // zero terminated text
+    size_t m_capacity{0};    // characters the buffer holds, excluding the terminator
+    size_t m_length{0};      // characters in the text
+};
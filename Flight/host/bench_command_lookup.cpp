@@ -0,0 +1,135 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for the command lookup
+ *
+ * Compares find_name() over the command names in CommandWarehouse.cpp, extracted by the
+ * Makefile, against the linear search it replaced, which compared the command against
+ * each String name in table order, length first and then characters. The linear search
+ * is measured over the 23 names of the original table in their original order and over
+ * the current names.
+ *
+ */
+
+#include "SortedNames.h"
+#include "host_benchmark.h"
+#include <vector>
+
+namespace
+{
+    constexpr size_t repetitions{20000}; /**< passes over the names per case @hideinitializer */
+
+    /**
+     * @brief Command table entry
+     *
+     */
+
+    struct Name
+    {
+        const char *command_name; /**< name used in ground commands */
+    };
+
+    /**
+     * @brief Command name with its length, as kept by String
+     *
+     */
+
+    struct Counted
+    {
+        const char *name; /**< name */
+        size_t length;    /**< characters in name */
+    };
+
+    const Name current_names[]{
+#include "command_names.h"
+    };
+
+    const Name original_names[]{
+        {"SetClock"}, {"BeaconSp"}, {"PicTimes"}, {"SSDVTimes"}, {"ClearPayloadQueue"}, {"ReportT"},
+        {"GetPayloadQueue"}, {"GetTelemetry"}, {"GetPower"}, {"GetComms"}, {"GetBeaconInterval"}, {"PayComms"},
+        {"TweeSlee"}, {"Watchdog"}, {"Invalid"}, {"Unknown"}, {"NoOperate"}, {"SendTestPacket"},
+        {"UnsetClock"}, {"LogArguments"}, {"BackgroundRSSI"}, {"CurrentRSSI"}, {"ModifyCCA"},
+    };
+
+    const Name misses[]{{""}, {"A"}, {"GetClock"}, {"Setclock"}, {"SetClockX"}, {"Zulu"}, {"getTelemetry"}, {"NoOperat"}};
+
+    volatile size_t index_sink{0}; /**< keeps the results observable */
+
+    /**
+     * @brief Names with their lengths
+     *
+     */
+
+    template <size_t Count>
+    std::vector<Counted> counted(const Name (&names)[Count])
+    {
+        std::vector<Counted> result{};
+        for (const auto &name : names)
+        {
+            result.push_back(Counted{name.command_name, strlen(name.command_name)});
+        }
+        return result;
+    }
+
+    /**
+     * @brief Linear search comparing as String::equals() does
+     *
+     */
+
+    size_t linear(const std::vector<Counted> &names, const Counted &command)
+    {
+        for (size_t index{0}; index < names.size(); ++index)
+        {
+            if (names[index].length == command.length && strcmp(names[index].name, command.name) == 0)
+            {
+                return index;
+            }
+        }
+        return names.size();
+    }
+
+    /**
+     * @brief Measure one search over a list of commands and report the results
+     *
+     */
+
+    template <typename Search>
+    void run(const char *name, const std::vector<Counted> &commands, Search search)
+    {
+        auto result{measure(repetitions, [&]() {
+            for (const auto &command : commands)
+            {
+                index_sink = index_sink + search(command);
+            }
+        })};
+        auto lookups{static_cast<double>(repetitions) * commands.size()};
+        printf("%-32s %7.1f ns/lookup %6.0f cycles/lookup %5.2f allocations/lookup\n", name,
+               result.elapsed * 1e9 / lookups, static_cast<double>(result.cycles) / lookups,
+               static_cast<double>(result.allocations) / lookups);
+    }
+
+    /**
+     * @brief Compare the searches for one list of commands
+     *
+     */
+
+    void compare(const char *name, const std::vector<Counted> &commands)
+    {
+        auto original{counted(original_names)};
+        auto current{counted(current_names)};
+        constexpr auto current_count{sizeof(current_names) / sizeof(current_names[0])};
+        printf("%s, %zu commands\n", name, commands.size());
+        run("  linear, 23 original names", commands, [&](const Counted &command) { return linear(original, command); });
+        run("  linear, current names", commands, [&](const Counted &command) { return linear(current, command); });
+        run("  find_name, current names", commands,
+            [&](const Counted &command) { return find_name(current_names, current_count, command.name, &Name::command_name); });
+    }
+}
+
+int main()
+{
+    printf("Command lookup, %zu current names, %zu passes per case\n", sizeof(current_names) / sizeof(current_names[0]), repetitions);
+    compare("original names", counted(original_names));
+    compare("current names", counted(current_names));
+    compare("unknown commands", counted(misses));
+    return 0;
+}
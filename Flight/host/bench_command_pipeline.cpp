@@ -0,0 +1,204 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for the ground command path
+ *
+ * Compares handing a received ground command from the KISS decoder to the command
+ * lookup as a view into the frame slot against the String path it replaced. In that
+ * path get_frame() copied the frame into a String, check_for_command() copied it again,
+ * validate_signature() took substrings for the HMAC, salt, sequence, and command,
+ * get_command() received a further substring and copied it, and the tokenizer filled a
+ * String token array. Both paths decode with KissDecoder and look the command up in the
+ * current command table. Neither computes the HMAC, because the Crypto library is not
+ * part of the host build; hashing reads the same bytes in both paths.
+ *
+ */
+
+#include "CommandToken.h"
+#include "KissDecoder.h"
+#include "SortedNames.h"
+#include "arduino_string_model.h"
+#include "host_benchmark.h"
+#include <string>
+
+namespace
+{
+    constexpr size_t repetitions{200000};      /**< commands processed per case @hideinitializer */
+    constexpr size_t signature_characters{88}; /**< text signature: HMAC, salt, and sequence @hideinitializer */
+    constexpr size_t hmac_characters{64};      /**< HMAC as hex characters @hideinitializer */
+    constexpr size_t salt_characters{16};      /**< salt as hex characters @hideinitializer */
+    constexpr size_t baseline_token_limit{10}; /**< token array size of the String tokenizer @hideinitializer */
+    constexpr size_t token_limit{16};          /**< token array size of tokenize() @hideinitializer */
+
+    /**
+     * @brief Command table entry
+     *
+     */
+
+    struct Name
+    {
+        const char *command_name; /**< name used in ground commands */
+    };
+
+    const Name names[]{
+#include "command_names.h"
+    };
+    constexpr size_t name_count{sizeof(names) / sizeof(names[0])};
+
+    volatile size_t result_sink{0}; /**< keeps the results observable */
+
+    /**
+     * @brief Decode a frame into the slot
+     *
+     * @return size_t frame length including the type, zero if no frame
+     *
+     */
+
+    size_t decode(const std::string &encoded, char *slot)
+    {
+        KissDecoder decoder{};
+        decoder.decode(reinterpret_cast<const uint8_t *>(encoded.data()), encoded.size(), slot, maximum_command_length);
+        return decoder.frame_complete() ? decoder.take_frame() : 0;
+    }
+
+    /**
+     * @brief Look up a command as the String path did
+     *
+     */
+
+    size_t string_lookup(const ArduinoString &name)
+    {
+        for (size_t index{0}; index < name_count; ++index)
+        {
+            if (strlen(names[index].command_name) == name.length() && strcmp(names[index].command_name, name.c_str()) == 0)
+            {
+                return index;
+            }
+        }
+        return name_count;
+    }
+
+    /**
+     * @brief Process a command through the String path
+     *
+     */
+
+    void string_path(const std::string &encoded)
+    {
+        static char slot[maximum_command_length + 1]{};
+        auto length{decode(encoded, slot)};
+        slot[length] = '\0';
+        // get_frame()
+        ArduinoString frame_command{slot + 1};
+        // check_for_command()
+        ArduinoString command_string{frame_command};
+        if (command_string.length() < signature_characters)
+        {
+            return;
+        }
+        // validate_signature()
+        auto hmac{command_string.substring(0, hmac_characters)};
+        auto salt{command_string.substring(hmac_characters, hmac_characters + salt_characters)};
+        auto sequence{command_string.substring(hmac_characters + salt_characters, signature_characters)};
+        auto command{command_string.substring(signature_characters)};
+        // get_command(substring)
+        auto argument{command_string.substring(signature_characters)};
+        ArduinoString get_command_string{argument};
+        ArduinoString tokens[baseline_token_limit]{};
+        get_command_string.trim();
+        // parse_parameters()
+        ArduinoString remaining{get_command_string};
+        size_t token_count{0};
+        while (remaining.length() > 0 && token_count < baseline_token_limit)
+        {
+            remaining.trim();
+            auto next_blank{remaining.indexOf(' ')};
+            if (next_blank == -1)
+            {
+                tokens[token_count++] = remaining;
+                remaining = "";
+            }
+            else
+            {
+                tokens[token_count++] = remaining.substring(0, static_cast<size_t>(next_blank));
+                remaining = remaining.substring(static_cast<size_t>(next_blank));
+            }
+        }
+        result_sink = result_sink + string_lookup(tokens[0]) + hmac.length() + salt.length() + sequence.length() + command.length();
+    }
+
+    /**
+     * @brief Process a command through the view path
+     *
+     */
+
+    void view_path(const std::string &encoded)
+    {
+        static char slot[maximum_command_length]{};
+        auto length{decode(encoded, slot)};
+        if (length < 1 + signature_characters)
+        {
+            return;
+        }
+        CommandToken tokens[token_limit]{};
+        size_t token_count{0};
+        if (tokenize(slot + 1 + signature_characters, length - 1 - signature_characters, tokens, token_limit, token_count) &&
+            token_count > 0)
+        {
+            result_sink = result_sink + find_name(names, name_count, tokens[0].c_str(), &Name::command_name);
+        }
+    }
+
+    /**
+     * @brief Build a KISS encoded ground command with a placeholder signature
+     *
+     */
+
+    std::string frame(const char *command)
+    {
+        std::string encoded{};
+        encoded.push_back(static_cast<char>(FEND));
+        encoded.push_back(static_cast<char>(REMOTE_FRAME));
+        encoded.append(hmac_characters + salt_characters, 'a');
+        encoded.append("00000042");
+        encoded.append(command);
+        encoded.push_back(static_cast<char>(FEND));
+        return encoded;
+    }
+
+    /**
+     * @brief Measure one path and report the results
+     *
+     */
+
+    template <typename Path>
+    void run(const char *name, const std::string &encoded, Path path)
+    {
+        auto result{measure(repetitions, [&]() { path(encoded); })};
+        auto commands{static_cast<double>(repetitions)};
+        printf("%-10s %8.1f ns/command %7.0f cycles/command %6.2f allocations/command\n", name,
+               result.elapsed * 1e9 / commands, static_cast<double>(result.cycles) / commands,
+               static_cast<double>(result.allocations) / commands);
+    }
+
+    /**
+     * @brief Compare the paths for one command
+     *
+     */
+
+    void compare(const char *command)
+    {
+        auto encoded{frame(command)};
+        printf("\"%s\", %zu byte frame\n", command, encoded.size());
+        run("  String", encoded, string_path);
+        run("  views", encoded, view_path);
+    }
+}
+
+int main()
+{
+    printf("Ground command path, %zu commands per case\n", repetitions);
+    compare("NoOperate");
+    compare("SetClock 2026 10 17 12 30 45");
+    compare("LogArguments alpha bravo charlie delta echo foxtrot golf hotel india");
+    return 0;
+}
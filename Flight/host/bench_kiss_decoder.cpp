@@ -0,0 +1,111 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for the KISS decoder
+ *
+ * Reports decoding throughput and cycles per byte for clean, escape heavy, and garbage
+ * input, decoding 64 byte slices as the receive buffer is drained on the Avionics Board
+ *
+ */
+
+#include "KissDecoder.h"
+#include "host_benchmark.h"
+#include <vector>
+
+namespace
+{
+    constexpr size_t input_size{1 << 20}; /**< bytes decoded per repetition @hideinitializer */
+    constexpr size_t slice_size{64};      /**< bytes offered per decode call @hideinitializer */
+    constexpr size_t frame_content{200};  /**< content bytes in each generated frame @hideinitializer */
+    constexpr size_t repetitions{20};     /**< repetitions of each input @hideinitializer */
+
+    /**
+     * @brief Generate framed input
+     *
+     * @param escape_every escape one content byte in this many, zero for none
+     *
+     */
+
+    std::vector<uint8_t> framed(const size_t escape_every)
+    {
+        std::vector<uint8_t> input{};
+        uint32_t state{12345};
+        while (input.size() < input_size)
+        {
+            input.push_back(FEND);
+            input.push_back(REMOTE_FRAME);
+            for (size_t index{0}; index < frame_content; ++index)
+            {
+                state = state * 1103515245u + 12345u;
+                if (escape_every != 0 && index % escape_every == 0)
+                {
+                    input.push_back(FESC);
+                    input.push_back((state >> 16) & 1 ? TFEND : TFESC);
+                }
+                else
+                {
+                    input.push_back(static_cast<uint8_t>(' ' + (state >> 16) % 95));
+                }
+            }
+            input.push_back(FEND);
+        }
+        return input;
+    }
+
+    /**
+     * @brief Generate random bytes
+     *
+     */
+
+    std::vector<uint8_t> garbage()
+    {
+        std::vector<uint8_t> input(input_size);
+        uint32_t state{54321};
+        for (auto &value : input)
+        {
+            state = state * 1103515245u + 12345u;
+            value = static_cast<uint8_t>(state >> 16);
+        }
+        return input;
+    }
+
+    /**
+     * @brief Decode the input and report the results
+     *
+     */
+
+    void run(const char *name, const std::vector<uint8_t> &input)
+    {
+        static char output[maximum_command_length]{};
+        size_t frames{0};
+        auto result{measure(repetitions, [&]() {
+            KissDecoder decoder{};
+            for (size_t offset{0}; offset < input.size(); offset += slice_size)
+            {
+                auto length{input.size() - offset < slice_size ? input.size() - offset : slice_size};
+                size_t used{0};
+                while (used < length)
+                {
+                    used += decoder.decode(input.data() + offset + used, length - used, output, sizeof(output));
+                    if (decoder.frame_complete())
+                    {
+                        decoder.take_frame();
+                        ++frames;
+                    }
+                }
+            }
+        })};
+        auto bytes{static_cast<double>(input.size()) * repetitions};
+        printf("%-14s %8.1f MB/s %6.2f cycles/byte %6.2f ns/byte %llu allocations (%zu frames)\n", name,
+               bytes / result.elapsed / 1e6, static_cast<double>(result.cycles) / bytes, result.elapsed * 1e9 / bytes,
+               static_cast<unsigned long long>(result.allocations), frames / (repetitions + 1));
+    }
+}
+
+int main()
+{
+    printf("KISS decoder, %zu byte slices\n", slice_size);
+    run("clean", framed(0));
+    run("escape heavy", framed(2));
+    run("garbage", garbage());
+    return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for the KISS encoder
+ *
+ * Compares queueing a response with the fragment encoder against the String path it
+ * replaced, in which Response concatenated "RES " and the content, Message::send passed
+ * the message by value, get_content() returned a copy, and the content was written to
+ * the UART unescaped.
+ *
+ */
+
+#include "KissEncoder.h"
+#include "RingBuffer.h"
+#include "arduino_string_model.h"
+#include "host_benchmark.h"
+#include <string>
+
+namespace
+{
+    constexpr size_t repetitions{200000}; /**< frames queued per case @hideinitializer */
+
+    /**
+     * @brief UART stand in which keeps the last byte written
+     *
+     */
+
+    struct Uart
+    {
+        volatile uint8_t last{0};
+        void write(const uint8_t value) { last = value; }
+    };
+
+    Uart uart{};
+    RingBuffer<1024> transmit_buffer{};
+
+    /**
+     * @brief Queue a response through the String path
+     *
+     */
+
+    void string_path(const char *header, const std::string &payload)
+    {
+        // "GTY" + get_telemetry()
+        ArduinoString content{header};
+        content.concat(payload.data(), payload.size());
+        // Response(const String content)
+        ArduinoString argument{content};
+        // RES + " " + content
+        ArduinoString framed{"RES"};
+        framed.concat(" ", 1);
+        framed.concat(argument.c_str(), argument.length());
+        // send_message(const Message message)
+        ArduinoString message{framed};
+        // message.get_content()
+        ArduinoString copy{message};
+        uart.write(FEND);
+        uart.write(REMOTE_FRAME);
+        for (size_t index{0}; index < copy.length(); ++index)
+        {
+            uart.write(static_cast<uint8_t>(copy.c_str()[index]));
+        }
+        uart.write(FEND);
+    }
+
+    /**
+     * @brief Queue a response through the fragment encoder and drain the queue
+     *
+     */
+
+    void fragment_path(const char *header, const std::string &payload)
+    {
+        char prefix[16]{};
+        auto length{static_cast<size_t>(snprintf(prefix, sizeof(prefix), "RES %s", header))};
+        const Fragment fragments[]{{prefix, length}, {payload.data(), payload.size()}};
+        if (!kiss_stage_frame(transmit_buffer, REMOTE_FRAME, fragments, 2))
+        {
+            transmit_buffer.discard();
+            return;
+        }
+        transmit_buffer.commit();
+        const uint8_t *data{nullptr};
+        while (auto available{transmit_buffer.peek(data)})
+        {
+            for (size_t index{0}; index < available; ++index)
+            {
+                uart.write(data[index]);
+            }
+            transmit_buffer.consume(available);
+        }
+    }
+
+    /**
+     * @brief Generate response content
+     *
+     * @param length characters of content
+     * @param escape_every make one character in this many a KISS special character, zero for none
+     *
+     */
+
+    std::string content(const size_t length, const size_t escape_every)
+    {
+        std::string result{};
+        for (size_t index{0}; index < length; ++index)
+        {
+            if (escape_every != 0 && index % escape_every == 0)
+            {
+                result.push_back(static_cast<char>(index % 2 ? FEND : FESC));
+            }
+            else
+            {
+                result.push_back(static_cast<char>('0' + index % 10));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Measure one path and report the results
+     *
+     */
+
+    template <typename Path>
+    void run(const char *name, const char *header, const std::string &payload, Path path)
+    {
+        auto result{measure(repetitions, [&]() { path(header, payload); })};
+        auto frames{static_cast<double>(repetitions)};
+        printf("%-26s %8.1f ns/frame %8.0f cycles/frame %5.2f allocations/frame\n", name, result.elapsed * 1e9 / frames,
+               static_cast<double>(result.cycles) / frames, static_cast<double>(result.allocations) / frames);
+    }
+
+    /**
+     * @brief Compare the paths for one response
+     *
+     */
+
+    void compare(const char *name, const char *header, const std::string &payload)
+    {
+        printf("%s, %zu content characters\n", name, payload.size());
+        run("  String, unescaped", header, payload, string_path);
+        run("  fragments, escaped", header, payload, fragment_path);
+    }
+}
+
+int main()
+{
+    printf("KISS encoder, %zu frames per case\n", repetitions);
+    compare("acknowledgement", "ACK", content(0, 0));
+    compare("telemetry", "GTY", content(120, 0));
+    compare("radio data", "GRS", content(radio_response_limit, 0));
+    compare("radio data, escape heavy", "GRS", content(radio_response_limit, 4));
+    return 0;
+}
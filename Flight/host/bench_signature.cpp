@@ -0,0 +1,145 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for ground command signature verification
+ *
+ * Compares SignatureVerifier, which copies keyed HMAC states computed once, against the
+ * verification it replaced, which called resetHMAC() and finalizeHMAC() with the secret
+ * for every command and so hashed both key blocks each time. Only built when CRYPTO_DIR
+ * names the source directory of the Crypto library; see the Makefile.
+ *
+ */
+
+#include "SignatureVerifier.h"
+#include "arduino_secrets.h"
+#include "host_benchmark.h"
+#include <string>
+
+namespace
+{
+    constexpr size_t repetitions{100000}; /**< verifications per case @hideinitializer */
+
+    const byte secret[]{SECRET_HASH_KEY}; /**< HMAC key */
+
+    volatile size_t valid_sink{0}; /**< keeps the results observable */
+
+    /**
+     * @brief Value of a hexadecimal digit
+     *
+     */
+
+    byte hex_value(const char character)
+    {
+        return static_cast<byte>(character <= '9' ? character - '0' : (character | 0x20) - 'a' + 10);
+    }
+
+    /**
+     * @brief Verify as the replaced code did, from the signed command text
+     *
+     */
+
+    bool reset_each_time(const std::string &signed_command)
+    {
+        byte hmac[hmac_length]{};
+        byte salt[salt_length]{};
+        for (size_t index{0}; index < hmac_length_hex_ascii + salt_length_hex_ascii; index += 2)
+        {
+            auto value{static_cast<byte>((hex_value(signed_command[index]) << 4) | hex_value(signed_command[index + 1]))};
+            if (index < hmac_length_hex_ascii)
+            {
+                hmac[index / 2] = value;
+            }
+            else
+            {
+                salt[(index - hmac_length_hex_ascii) / 2] = value;
+            }
+        }
+        BLAKE2s blake{};
+        byte computed_hmac[hmac_length]{};
+        blake.resetHMAC(secret, sizeof(secret));
+        blake.update(salt, salt_length);
+        blake.update(signed_command.data() + hmac_length_hex_ascii + salt_length_hex_ascii,
+                     signed_command.size() - hmac_length_hex_ascii - salt_length_hex_ascii);
+        blake.finalizeHMAC(secret, sizeof(secret), computed_hmac, hmac_length);
+        return memcmp(computed_hmac, hmac, hmac_length) == 0;
+    }
+
+    /**
+     * @brief Verify with SignatureVerifier
+     *
+     */
+
+    bool cached_keys(SignatureVerifier &verifier, const std::string &signed_command)
+    {
+        verifier.start(false);
+        verifier.update(signed_command.data(), signed_command.size());
+        return verifier.finish();
+    }
+
+    /**
+     * @brief Sign a command in the text format
+     *
+     * @param command command text
+     * @return std::string hex HMAC, hex salt, decimal sequence, and command
+     *
+     */
+
+    std::string sign(const char *command)
+    {
+        constexpr char digits[]{"0123456789abcdef"};
+        const byte salt[salt_length]{0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+        std::string sequence_and_command{"00000042"};
+        sequence_and_command.append(command);
+        BLAKE2s blake{};
+        byte hmac[hmac_length]{};
+        blake.resetHMAC(secret, sizeof(secret));
+        blake.update(salt, salt_length);
+        blake.update(sequence_and_command.data(), sequence_and_command.size());
+        blake.finalizeHMAC(secret, sizeof(secret), hmac, hmac_length);
+        std::string signed_command{};
+        for (auto value : hmac)
+        {
+            signed_command.push_back(digits[value >> 4]);
+            signed_command.push_back(digits[value & 0x0F]);
+        }
+        for (auto value : salt)
+        {
+            signed_command.push_back(digits[value >> 4]);
+            signed_command.push_back(digits[value & 0x0F]);
+        }
+        return signed_command + sequence_and_command;
+    }
+
+    /**
+     * @brief Measure one verification and report the results
+     *
+     */
+
+    template <typename Verify>
+    void run(const char *name, Verify verify)
+    {
+        auto result{measure(repetitions, [&]() { valid_sink = valid_sink + verify(); })};
+        auto verifications{static_cast<double>(repetitions)};
+        printf("%-16s %9.0f verifications/s %7.0f cycles/verification\n", name, verifications / result.elapsed,
+               static_cast<double>(result.cycles) / verifications);
+    }
+}
+
+int main()
+{
+    SignatureVerifier verifier{};
+    verifier.begin();
+    printf("Signature verification, %zu verifications per case\n", repetitions);
+    for (auto command : {"NoOperate", "SetClock 2026 10 17 12 30 45"})
+    {
+        auto signed_command{sign(command)};
+        if (!reset_each_time(signed_command) || !cached_keys(verifier, signed_command))
+        {
+            printf("%s: signature not verified\n", command);
+            return 1;
+        }
+        printf("\"%s\", %zu characters\n", command, signed_command.size());
+        run("  reset each time", [&]() { return reset_each_time(signed_command); });
+        run("  cached keys", [&]() { return cached_keys(verifier, signed_command); });
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark for the command tokenizer
+ *
+ * Compares tokenize() against the String tokenizer it replaced, in which get_command()
+ * copied the frame into a String, trimmed it, and filled a String token array using
+ * trim(), indexOf(), and substring() on the remaining command
+ *
+ */
+
+#include "CommandToken.h"
+#include "arduino_string_model.h"
+#include "host_benchmark.h"
+
+namespace
+{
+    constexpr size_t repetitions{500000};      /**< commands tokenized per case @hideinitializer */
+    constexpr size_t baseline_token_limit{10}; /**< token array size of the String tokenizer @hideinitializer */
+    constexpr size_t token_limit{16};          /**< token array size of tokenize() @hideinitializer */
+
+    volatile size_t token_sink{0}; /**< keeps the results observable */
+
+    /**
+     * @brief Tokenize with the String tokenizer
+     *
+     */
+
+    void string_tokenizer(const char *command)
+    {
+        ArduinoString command_string{command};
+        ArduinoString command_tokens[baseline_token_limit]{};
+        command_string.trim();
+        size_t token_index{0};
+        ArduinoString remaining{command_string};
+        while (remaining.length() > 0)
+        {
+            if (token_index >= baseline_token_limit)
+            {
+                return;
+            }
+            remaining.trim();
+            auto next_blank{remaining.indexOf(' ')};
+            if (next_blank == -1)
+            {
+                command_tokens[token_index++] = remaining;
+                remaining = "";
+            }
+            else
+            {
+                command_tokens[token_index++] = remaining.substring(0, static_cast<size_t>(next_blank));
+                remaining = remaining.substring(static_cast<size_t>(next_blank));
+            }
+        }
+        token_sink = token_sink + token_index;
+    }
+
+    /**
+     * @brief Tokenize in place
+     *
+     * The command is first copied to a scratch buffer, standing in for the frame queue
+     * slot, because tokenizing overwrites the separators
+     *
+     */
+
+    void view_tokenizer(const char *command)
+    {
+        static char text[maximum_command_length]{};
+        auto length{strlen(command)};
+        memcpy(text, command, length);
+        CommandToken tokens[token_limit]{};
+        size_t token_count{0};
+        if (tokenize(text, length, tokens, token_limit, token_count))
+        {
+            token_sink = token_sink + token_count;
+        }
+    }
+
+    /**
+     * @brief Measure one tokenizer and report the results
+     *
+     */
+
+    template <typename Tokenizer>
+    void run(const char *name, const char *command, Tokenizer tokenizer)
+    {
+        auto result{measure(repetitions, [&]() { tokenizer(command); })};
+        auto commands{static_cast<double>(repetitions)};
+        printf("%-12s %8.1f ns/command %8.0f cycles/command %6.2f allocations/command\n", name,
+               result.elapsed * 1e9 / commands, static_cast<double>(result.cycles) / commands,
+               static_cast<double>(result.allocations) / commands);
+    }
+
+    /**
+     * @brief Compare the tokenizers for one command
+     *
+     */
+
+    void compare(const char *name, const char *command)
+    {
+        printf("%s: \"%s\"\n", name, command);
+        run("  String", command, string_tokenizer);
+        run("  tokenize", command, view_tokenizer);
+    }
+}
+
+int main()
+{
+    printf("Command tokenizer, %zu commands per case\n", repetitions);
+    compare("SetClock, 7 tokens", "SetClock 2026 10 17 12 30 45");
+    compare("10 tokens", "  LogArguments alpha bravo charlie delta echo foxtrot golf hotel india ");
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host benchmark timing and allocation counting
+ *
+ * This file implements the timers and the heap allocation counter shared by the host
+ * benchmarks. Include it in exactly one translation unit of each benchmark, which must
+ * be linked with the malloc wrappers named in the Makefile.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+static volatile uint64_t allocation_count{0}; /**< heap allocations since the program started */
+
+extern "C"
+{
+    void *__real_malloc(size_t size);
+    void *__real_calloc(size_t count, size_t size);
+    void *__real_realloc(void *pointer, size_t size);
+
+    void *__wrap_malloc(size_t size)
+    {
+        ++allocation_count;
+        return __real_malloc(size);
+    }
+
+    void *__wrap_calloc(size_t count, size_t size)
+    {
+        ++allocation_count;
+        return __real_calloc(count, size);
+    }
+
+    void *__wrap_realloc(void *pointer, size_t size)
+    {
+        ++allocation_count;
+        return __real_realloc(pointer, size);
+    }
+}
+
+void *operator new(size_t size)
+{
+    auto pointer{malloc(size)};
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept { free(pointer); }
+void operator delete(void *pointer, size_t) noexcept { free(pointer); }
+
+/**
+ * @brief Processor timestamp counter
+ *
+ * @return uint64_t cycles, zero where no counter is available
+ *
+ */
+
+inline uint64_t cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Monotonic time
+ *
+ * @return double seconds
+ *
+ */
+
+inline double seconds()
+{
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Measurement of a repeated operation
+ *
+ */
+
+struct Measurement
+{
+    double elapsed;       /**< seconds */
+    uint64_t cycles;      /**< timestamp counter cycles */
+    uint64_t allocations; /**< heap allocations */
+};
+
+/**
+ * @brief Measure a repeated operation
+ *
+ * @tparam Operation callable run once per repetition
+ * @param repetitions number of repetitions
+ * @param operation operation to measure
+ * @return Measurement totals for all repetitions
+ *
+ */
+
+template <typename Operation>
+Measurement measure(const size_t repetitions, Operation operation)
+{
+    operation(); // warm the caches
+    auto allocations{allocation_count};
+    auto start_cycles{cycles()};
+    auto start{seconds()};
+    for (size_t repetition{0}; repetition < repetitions; ++repetition)
+    {
+        operation();
+    }
+    Measurement result{};
+    result.elapsed = seconds() - start;
+    result.cycles = cycles() - start_cycles;
+    result.allocations = allocation_count - allocations;
+    return result;
+}
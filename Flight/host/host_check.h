@@ -0,0 +1,41 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit test checks
+ *
+ * This file declares the check macro and result reporting shared by the host unit tests
+ *
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+static int check_failures{0}; /**< failed checks in this test program */
+
+/**
+ * @brief Check a condition and report the location if it fails
+ *
+ */
+
+#define CHECK(condition)                                                                  \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(condition))                                                                 \
+        {                                                                                 \
+            ++check_failures;                                                             \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+        }                                                                                 \
+    } while (0)
+
+/**
+ * @brief Report the result of a test program
+ *
+ * @return int exit status, zero if all checks passed
+ *
+ */
+
+inline int check_result(const char *name)
+{
+    printf("%s: %s\n", name, check_failures == 0 ? "passed" : "FAILED");
+    return check_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the KISS decoder
+ *
+ */
+
+#include "KissDecoder.h"
+#include "host_check.h"
+
+namespace
+{
+    constexpr size_t capacity{16}; /**< output buffer size for the tests @hideinitializer */
+
+    /**
+     * @brief Decoder with its output buffer
+     *
+     */
+
+    struct Decoder
+    {
+        KissDecoder decoder{};
+        char output[capacity]{};
+
+        size_t decode(const char *input, const size_t length)
+        {
+            return decoder.decode(reinterpret_cast<const uint8_t *>(input), length, output, capacity);
+        }
+    };
+
+    void test_clean_frame()
+    {
+        Decoder d{};
+        const char input[]{"\xC0\xAAhello\xC0"};
+        CHECK(d.decode(input, 8) == 8);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 6);
+        CHECK(memcmp(d.output, "\xAAhello", 6) == 0);
+        CHECK(d.decoder.take_frame() == 6);
+        CHECK(!d.decoder.frame_complete());
+    }
+
+    void test_escapes()
+    {
+        Decoder d{};
+        const char input[]{"\xC0\xAA\xDB\xDCx\xDB\xDD\xC0"};
+        d.decode(input, 8);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 4);
+        CHECK(memcmp(d.output, "\xAA\xC0x\xDB", 4) == 0);
+        CHECK(d.decoder.escape_errors() == 0);
+    }
+
+    void test_outside_frame()
+    {
+        Decoder d{};
+        const char input[]{"ab\xDB\xC0x\xC0"};
+        d.decode(input, 6);
+        CHECK(d.decoder.outside_frame_errors() == 3);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 1);
+    }
+
+    void test_invalid_escape()
+    {
+        Decoder d{};
+        const char input[]{"\xC0x\xDBqy\xC0"};
+        d.decode(input, 6);
+        CHECK(d.decoder.escape_errors() == 1);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 2);
+        CHECK(memcmp(d.output, "xy", 2) == 0);
+    }
+
+    void test_aborted_frame()
+    {
+        Decoder d{};
+        const char input[]{"\xC0xy\xDB\xC0z\xC0"};
+        CHECK(d.decode(input, 7) == 5);
+        CHECK(d.decoder.aborted_frames() == 1);
+        CHECK(!d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 0);
+        d.decode(input + 5, 2);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 1);
+        CHECK(d.output[0] == 'z');
+    }
+
+    void test_overflow()
+    {
+        Decoder d{};
+        char input[capacity + 6]{};
+        input[0] = '\xC0';
+        memset(input + 1, 'x', capacity + 4);
+        input[capacity + 5] = '\xC0';
+        d.decode(input, sizeof(input));
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == capacity);
+        CHECK(d.decoder.overflow_errors() == 4);
+    }
+
+    void test_empty_frames_ignored()
+    {
+        Decoder d{};
+        const char input[]{"\xC0\xC0\xC0x\xC0"};
+        d.decode(input, 5);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 1);
+    }
+
+    void test_shared_fend()
+    {
+        Decoder d{};
+        const char input[]{"\xC0x\xC0y\xC0"};
+        auto used{d.decode(input, 5)};
+        CHECK(used == 3);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decode(input + used, 5 - used) == 0); // frame must be taken first
+        CHECK(d.decoder.take_frame() == 1);
+        d.decode(input + used, 5 - used);
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 1);
+        CHECK(d.output[0] == 'y');
+    }
+
+    void test_byte_at_a_time()
+    {
+        Decoder d{};
+        const char input[]{"\xC0\xAA\xDB\xDCz\xC0"};
+        for (size_t index{0}; index < 6; ++index)
+        {
+            CHECK(!d.decoder.frame_complete());
+            CHECK(d.decode(input + index, 1) == 1);
+        }
+        CHECK(d.decoder.frame_complete());
+        CHECK(d.decoder.length() == 3);
+        CHECK(memcmp(d.output, "\xAA\xC0z", 3) == 0);
+    }
+}
+
+int main()
+{
+    test_clean_frame();
+    test_escapes();
+    test_outside_frame();
+    test_invalid_escape();
+    test_aborted_frame();
+    test_overflow();
+    test_empty_frames_ignored();
+    test_shared_fend();
+    test_byte_at_a_time();
+    return check_result("test_kiss_decoder");
+}
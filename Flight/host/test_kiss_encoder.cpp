@@ -0,0 +1,106 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the KISS encoder
+ *
+ */
+
+#include "KissDecoder.h"
+#include "KissEncoder.h"
+#include "RingBuffer.h"
+#include "host_check.h"
+#include <string.h>
+
+namespace
+{
+    /**
+     * @brief Copy the committed contents of a queue
+     *
+     */
+
+    template <size_t Size>
+    size_t drain(RingBuffer<Size> &queue, uint8_t *output)
+    {
+        size_t length{0};
+        const uint8_t *data{nullptr};
+        while (auto available{queue.peek(data)})
+        {
+            memcpy(output + length, data, available);
+            length += available;
+            queue.consume(available);
+        }
+        return length;
+    }
+
+    void test_fragments()
+    {
+        RingBuffer<64> queue{};
+        const Fragment fragments[]{{"RES ", 4}, {"ACKxx", 3}};
+        CHECK(kiss_stage_frame(queue, REMOTE_FRAME, fragments, 2));
+        CHECK(queue.available() == 0);
+        CHECK(queue.commit() == 10);
+        uint8_t output[64]{};
+        CHECK(drain(queue, output) == 10);
+        CHECK(memcmp(output, "\xC0\xAARES ACK\xC0", 10) == 0);
+    }
+
+    void test_escapes()
+    {
+        RingBuffer<64> queue{};
+        const Fragment fragment{"\xC0x\xDB", 3};
+        CHECK(kiss_stage_frame(queue, FEND, &fragment, 1));
+        uint8_t output[64]{};
+        queue.commit();
+        CHECK(drain(queue, output) == 9);
+        CHECK(memcmp(output, "\xC0\xDB\xDC\xDB\xDCx\xDB\xDD\xC0", 9) == 0);
+    }
+
+    void test_encoded_limit()
+    {
+        RingBuffer<64> queue{};
+        const Fragment fragment{"\xC0\xDB\xC0", 3};
+        CHECK(kiss_stage_frame(queue, FEND, &fragment, 1));
+        CHECK(queue.commit() == kiss_encoded_limit(3));
+    }
+
+    void test_queue_full()
+    {
+        RingBuffer<8> queue{};
+        const Fragment fragment{"\xC0\xC0\xC0", 3};
+        CHECK(!kiss_stage_frame(queue, REMOTE_FRAME, &fragment, 1));
+        queue.discard();
+        CHECK(queue.commit() == 0);
+        CHECK(queue.available() == 0);
+    }
+
+    void test_round_trip()
+    {
+        RingBuffer<1024> queue{};
+        char content[256]{};
+        for (size_t index{0}; index < sizeof(content); ++index)
+        {
+            content[index] = static_cast<char>(index);
+        }
+        const Fragment fragments[]{{content, 100}, {content + 100, 156}};
+        CHECK(kiss_stage_frame(queue, REMOTE_FRAME, fragments, 2));
+        queue.commit();
+        uint8_t encoded[1024]{};
+        auto length{drain(queue, encoded)};
+        KissDecoder decoder{};
+        char decoded[300]{};
+        CHECK(decoder.decode(encoded, length, decoded, sizeof(decoded)) == length);
+        CHECK(decoder.frame_complete());
+        CHECK(decoder.length() == 257);
+        CHECK(decoded[0] == static_cast<char>(REMOTE_FRAME));
+        CHECK(memcmp(decoded + 1, content, sizeof(content)) == 0);
+    }
+}
+
+int main()
+{
+    test_fragments();
+    test_escapes();
+    test_encoded_limit();
+    test_queue_full();
+    test_round_trip();
+    return check_result("test_kiss_encoder");
+}
@@ -0,0 +1,78 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the log2 histogram
+ *
+ */
+
+#include "Log2Histogram.h"
+#include "host_check.h"
+
+namespace
+{
+    using ByteHistogram = Log2Histogram<uint8_t, 16, 5>;
+    using WordHistogram = Log2Histogram<uint16_t, 16, 4>;
+
+    void test_buckets()
+    {
+        CHECK(ByteHistogram::bucket(0) == 0);
+        CHECK(ByteHistogram::bucket(31) == 0);
+        CHECK(ByteHistogram::bucket(32) == 1);
+        CHECK(ByteHistogram::bucket(63) == 1);
+        CHECK(ByteHistogram::bucket(64) == 2);
+        CHECK(ByteHistogram::bucket(UINT32_MAX) == 15);
+        CHECK(WordHistogram::bucket(15) == 0);
+        CHECK(WordHistogram::bucket(16) == 1);
+    }
+
+    void test_format()
+    {
+        ByteHistogram histogram{};
+        char buffer[64]{};
+        CHECK(histogram.empty());
+        CHECK(histogram.format(buffer, sizeof(buffer)) == 2);
+        CHECK(strcmp(buffer, " -") == 0);
+        histogram.record(40);
+        histogram.record(200);
+        histogram.record(200);
+        CHECK(!histogram.empty());
+        CHECK(histogram.format(buffer, sizeof(buffer)) == 9);
+        CHECK(strcmp(buffer, " 1-010002") == 0);
+        CHECK(histogram.format(buffer, 9) == 0);
+        WordHistogram words{};
+        words.record(20);
+        CHECK(words.format(buffer, sizeof(buffer)) == 7);
+        CHECK(strcmp(buffer, " 1-0001") == 0);
+    }
+
+    void test_halving()
+    {
+        ByteHistogram histogram{};
+        char buffer[64]{};
+        for (size_t count{0}; count < 255; ++count)
+        {
+            histogram.record(0);
+        }
+        histogram.record(40);
+        histogram.record(40);
+        histogram.record(0);
+        CHECK(histogram.format(buffer, sizeof(buffer)) == 7);
+        CHECK(strcmp(buffer, " 0-8001") == 0);
+    }
+
+    void test_clear()
+    {
+        ByteHistogram histogram{};
+        histogram.record(1000);
+        histogram.clear();
+        CHECK(histogram.empty());
+    }
+}
+
+int main()
+{
+    test_buckets();
+    test_format();
+    test_halving();
+    test_clear();
+    return check_result("test_log2_histogram");
+}
@@ -0,0 +1,162 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the ring buffer
+ *
+ * The receive interrupt handler pushes each character into the ring buffer while the
+ * process loop may be stalled, for example by a long I2C transaction. These tests push
+ * bursts with no draining in between, as the handler would at line rate, then drain as
+ * the process loop does with peek() and consume().
+ *
+ */
+
+#include "RingBuffer.h"
+#include "host_check.h"
+#include <string.h>
+
+namespace
+{
+    using TestBuffer = RingBuffer<16>;
+
+    /**
+     * @brief Drain the buffer as the process loop does
+     *
+     * @param buffer buffer to drain
+     * @param[out] output bytes removed
+     * @param capacity size of output
+     * @return size_t bytes removed
+     *
+     */
+
+    size_t drain(TestBuffer &buffer, uint8_t *output, const size_t capacity)
+    {
+        size_t length{0};
+        const uint8_t *data{nullptr};
+        size_t contiguous{0};
+        while ((contiguous = buffer.peek(data)) > 0 && length + contiguous <= capacity)
+        {
+            memcpy(output + length, data, contiguous);
+            buffer.consume(contiguous);
+            length += contiguous;
+        }
+        return length;
+    }
+
+    void test_burst_to_capacity()
+    {
+        TestBuffer buffer{};
+        for (size_t index{0}; index < TestBuffer::capacity(); ++index)
+        {
+            CHECK(buffer.push(static_cast<uint8_t>(index)));
+        }
+        CHECK(buffer.available() == TestBuffer::capacity());
+        CHECK(buffer.high_water_mark() == TestBuffer::capacity());
+        CHECK(buffer.overflows() == 0);
+        uint8_t output[TestBuffer::capacity()]{};
+        CHECK(drain(buffer, output, sizeof(output)) == TestBuffer::capacity());
+        for (size_t index{0}; index < TestBuffer::capacity(); ++index)
+        {
+            CHECK(output[index] == index);
+        }
+        CHECK(buffer.available() == 0);
+    }
+
+    void test_overflow()
+    {
+        TestBuffer buffer{};
+        for (size_t index{0}; index < TestBuffer::capacity() + 3; ++index)
+        {
+            buffer.push(static_cast<uint8_t>(index));
+        }
+        CHECK(buffer.overflows() == 3);
+        CHECK(buffer.available() == TestBuffer::capacity());
+        CHECK(!buffer.push(0xFF));
+        CHECK(buffer.overflows() == 4);
+        uint8_t output[TestBuffer::capacity()]{};
+        CHECK(drain(buffer, output, sizeof(output)) == TestBuffer::capacity());
+        CHECK(output[TestBuffer::capacity() - 1] == TestBuffer::capacity() - 1);
+        CHECK(buffer.push(0x42));
+        CHECK(buffer.overflows() == 4);
+    }
+
+    void test_high_water_mark()
+    {
+        TestBuffer buffer{};
+        uint8_t output[TestBuffer::capacity()]{};
+        for (size_t index{0}; index < 5; ++index)
+        {
+            buffer.push(0);
+        }
+        drain(buffer, output, sizeof(output));
+        for (size_t index{0}; index < 3; ++index)
+        {
+            buffer.push(0);
+        }
+        CHECK(buffer.high_water_mark() == 5);
+        for (size_t index{0}; index < 6; ++index)
+        {
+            buffer.push(0);
+        }
+        CHECK(buffer.high_water_mark() == 9);
+        buffer.clear();
+        CHECK(buffer.available() == 0);
+        CHECK(buffer.high_water_mark() == 9);
+    }
+
+    void test_stage_commit_discard()
+    {
+        TestBuffer buffer{};
+        CHECK(buffer.stage('a'));
+        CHECK(buffer.stage('b'));
+        CHECK(buffer.available() == 0);
+        buffer.discard();
+        CHECK(buffer.available() == 0);
+        CHECK(buffer.stage('c'));
+        CHECK(buffer.stage('d'));
+        CHECK(buffer.commit() == 2);
+        CHECK(buffer.available() == 2);
+        CHECK(buffer.high_water_mark() == 2);
+        for (size_t index{2}; index < TestBuffer::capacity(); ++index)
+        {
+            CHECK(buffer.stage('e'));
+        }
+        CHECK(!buffer.stage('f'));
+        buffer.discard();
+        CHECK(buffer.commit() == 0);
+        uint8_t output[TestBuffer::capacity()]{};
+        CHECK(drain(buffer, output, sizeof(output)) == 2);
+        CHECK(output[0] == 'c' && output[1] == 'd');
+    }
+
+    void test_drain_across_wrap()
+    {
+        TestBuffer buffer{};
+        uint8_t output[TestBuffer::capacity()]{};
+        for (size_t index{0}; index < 10; ++index)
+        {
+            buffer.push(0);
+        }
+        drain(buffer, output, sizeof(output));
+        for (size_t index{0}; index < TestBuffer::capacity(); ++index)
+        {
+            CHECK(buffer.push(static_cast<uint8_t>(index)));
+        }
+        const uint8_t *data{nullptr};
+        CHECK(buffer.peek(data) == TestBuffer::capacity() - 10);
+        CHECK(drain(buffer, output, sizeof(output)) == TestBuffer::capacity());
+        for (size_t index{0}; index < TestBuffer::capacity(); ++index)
+        {
+            CHECK(output[index] == index);
+        }
+        CHECK(buffer.peek(data) == 0);
+    }
+}
+
+int main()
+{
+    test_burst_to_capacity();
+    test_overflow();
+    test_high_water_mark();
+    test_stage_commit_discard();
+    test_drain_across_wrap();
+    return check_result("test_ring_buffer");
+}
@@ -0,0 +1,49 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the sorted name search
+ *
+ */
+
+#include "SortedNames.h"
+#include "host_check.h"
+
+namespace
+{
+    struct Name
+    {
+        const char *name;
+    };
+
+    const Name names[]{{"Alpha"}, {"Bravo"}, {"Charlie"}, {"Delta"}, {"Echo"}};
+    constexpr size_t count{sizeof(names) / sizeof(names[0])};
+
+    void test_hits()
+    {
+        for (size_t index{0}; index < count; ++index)
+        {
+            CHECK(find_name(names, count, names[index].name, &Name::name) == index);
+        }
+    }
+
+    void test_misses()
+    {
+        CHECK(find_name(names, count, "", &Name::name) == count);
+        CHECK(find_name(names, count, "Alph", &Name::name) == count);
+        CHECK(find_name(names, count, "AlphaX", &Name::name) == count);
+        CHECK(find_name(names, count, "alpha", &Name::name) == count);
+        CHECK(find_name(names, count, "Zulu", &Name::name) == count);
+    }
+
+    void test_empty_table()
+    {
+        CHECK(find_name(names, 0, "Alpha", &Name::name) == 0);
+    }
+}
+
+int main()
+{
+    test_hits();
+    test_misses();
+    test_empty_table();
+    return check_result("test_sorted_names");
+}
@@ -0,0 +1,66 @@
+/**
+ * @author Lee A. Congdon (lee@silversat.org)
+ * @brief Host unit tests for the command tokenizer
+ *
+ */
+
+#include "CommandToken.h"
+#include "host_check.h"
+
+namespace
+{
+    constexpr size_t limit{4}; /**< token array size for the tests @hideinitializer */
+
+    void test_tokens()
+    {
+        char text[]{"  SetClock 2026\t10  "};
+        CommandToken tokens[limit]{};
+        size_t count{0};
+        CHECK(tokenize(text, strlen(text), tokens, limit, count));
+        CHECK(count == 3);
+        CHECK(strcmp(tokens[0].c_str(), "SetClock") == 0);
+        CHECK(tokens[0].length() == 8);
+        CHECK(strcmp(tokens[1].c_str(), "2026") == 0);
+        CHECK(tokens[2].to_long() == 10);
+        CHECK(tokens[2].length() == 2);
+    }
+
+    void test_empty()
+    {
+        char text[]{" \t "};
+        CommandToken tokens[limit]{};
+        size_t count{99};
+        CHECK(tokenize(text, strlen(text), tokens, limit, count));
+        CHECK(count == 0);
+    }
+
+    void test_length_not_terminator()
+    {
+        char text[]{"NoOperate extra"};
+        CommandToken tokens[limit]{};
+        size_t count{0};
+        CHECK(tokenize(text, 9, tokens, limit, count));
+        CHECK(count == 1);
+        CHECK(tokens[0].length() == 9);
+    }
+
+    void test_too_many()
+    {
+        char text[]{"a b c d"};
+        CommandToken tokens[limit]{};
+        size_t count{0};
+        CHECK(tokenize(text, strlen(text), tokens, limit, count));
+        CHECK(count == 4);
+        char longer[]{"a b c d e"};
+        CHECK(!tokenize(longer, strlen(longer), tokens, limit, count));
+    }
+}
+
+int main()
+{
+    test_tokens();
+    test_empty();
+    test_length_not_terminator();
+    test_too_many();
+    return check_result("test_tokenizer");
+}
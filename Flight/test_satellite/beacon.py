@@ -0,0 +1,59 @@
+##
+# @brief FlatSat beacon decoder
+# @author Lee A. Congdon (lee@silversat.org)
+
+"""FlatSat beacon decoder
+
+The decoding tables are read from the Avionics Board Beacon.h so that the
+ground tools and the flight software share one definition.
+"""
+
+import os
+import re
+
+## location of the flight software beacon definitions
+
+BEACON_HEADER = os.path.join(os.path.dirname(__file__), "..", "avionics", "Beacon.h")
+
+## beacon status enumerations and tables, in beacon order
+
+BEACON_FIELDS = ("power", "avionics", "payload")
+
+
+## Read the beacon tables
+#
+# Returns a dictionary for each beacon field mapping beacon characters to status names
+#
+def load_tables(header=BEACON_HEADER):
+    source = open(header, "r").read()
+    tables = {}
+    for field in BEACON_FIELDS:
+        enumeration = re.search(
+            r"enum class " + field.capitalize() + r"Beacon\s*\{([^}]*)\}", source
+        ).group(1)
+        names = [name.strip() for name in enumeration.split(",") if name.strip()]
+        names.remove("count")
+        codes = re.search(
+            r"constexpr char " + field + r"_beacon_codes\[\]\{\"(\w+)\"\}", source
+        ).group(1)
+        if len(codes) != len(names):
+            raise ValueError(f"{field} beacon table does not match enumeration")
+        tables[field] = dict(zip(codes, names))
+    return tables
+
+
+## beacon tables
+
+tables = load_tables()
+
+
+## Decode a beacon
+#
+# Returns the status names for the power, avionics, and payload characters
+#
+def decode(beacon):
+    if isinstance(beacon, bytes):
+        beacon = beacon.decode("utf-8")
+    return tuple(
+        tables[field].get(code, "unknown") for field, code in zip(BEACON_FIELDS, beacon)
+    )
@@ -39,12 +39,14 @@ TFESC = b"\xDD"  # transposed frame escape
 
 LOCAL_FRAME = b"\x00"
 REMOTE_FRAME = b"\xAA"
+REMOTE_BINARY_FRAME = b"\xAB"
 BEACON = b"\x07"
 DIGITALIO_RELEASE = b"\x08"
 STATUS = b"\x09"
 HALT = b"\x0A"
 MODIFY_MODE = b"\x0C"
 TOGGLE_RADIO_5V = b"\x0F"
+MODIFY_BAUD_RATE = b"\x1C"
 
 ## serial port for commands and responses
 
@@ -68,12 +70,11 @@ clear_payload_queue_pattern = re.compile(rb"^RES CPQ$")
 reportt_pattern = re.compile(
     rb"^RES GRC 20\d\d-(0[1-9]|1[012])-(0[1-9]|[12]\d|3[01])T([01]\d|2[0-4]):([0-5]\d):([0-5]\d)$"
 )
-# todo: update payload queue pattern
 payload_queue_pattern = re.compile(
-    rb"^RES GPQ \d{1,2} entries in queue$"
-    # toto: verify the additional responses if any
-    # rb"^RES GPQ [0-5]( 20\d\d-(0[1-9]|1[012])-(0[1-9]|[12]\d|3[01])T([01]\d|2[0-4]):([0-5]\d):([0-5]\d)){0,5}$"
+    rb"^RES GPQ\+? \d{1,3}"
+    rb"(;\d{1,2} 20\d\d-(0[1-9]|1[012])-(0[1-9]|[12]\d|3[01])T([01]\d|2[0-4]):([0-5]\d):([0-5]\d) (Photo|SSDV|Unknown))*$"
 )
+payload_queue_compact_pattern = re.compile(rb"^RES GPQ\+? \d{1,3}(;\d{1,2} [0-9a-f]{8} (Photo|SSDV|Unknown))*$")
 telemetry_pattern = re.compile(
     rb"(^RES GTY AX -?\d+\.\d+)( AY -?\d+\.\d+)( AZ -?\d+\.\d+)( RX -?\d+\.\d+)( RY -?\d+\.\d+)( RZ -?\d+\.\d+)( T -?\d+\.\d+)$"
 )
@@ -82,6 +83,7 @@ power_pattern = re.compile(
 )
 # todo: update radio status pattern
 comms_pattern = re.compile(b"^RES GRS .*$")
+link_stats_pattern = re.compile(rb"^RES GLS( [0-9a-f]{1,8}){18}$")
 beacon_interval_pattern = re.compile(rb"^RES GBI \d+$")
 pay_comms_pattern = re.compile(rb"^RES PYC$")
 twee_slee_pattern = re.compile(rb"^RES TSL$")
@@ -93,6 +95,22 @@ test_packet_pattern = re.compile(rb"^RES STP test packet$")
 unset_clock_pattern = re.compile(rb"^RES URC$")
 background_rssi_pattern = re.compile(rb"^RES RBR \d{1,3}$")
 current_rssi_pattern = re.compile(rb"^RES RBC \d{1,3}$")
+modify_baud_pattern = re.compile(rb"^RES RMB$")
+store_command_pattern = re.compile(rb"^RES STC \d{1,2}$")
+stored_commands_pattern = re.compile(rb"^RES GSC\+? \d{1,2}(;20\d\d-\d\d-\d\dT\d\d:\d\d:\d\d [^;]+)*$")
+clear_stored_commands_pattern = re.compile(rb"^RES CSC$")
+stored_results_pattern = re.compile(rb"^RES GSR\+? \d{1,2} \d+(;20\d\d-\d\d-\d\dT\d\d:\d\d:\d\d [01] [^;]+)*$")
+stored_no_operate_pattern = re.compile(rb"^RES GSR 1 0;20\d\d-\d\d-\d\dT\d\d:\d\d:\d\d 1 NoOperate NOP$")
+command_latency_pattern = re.compile(rb"^RES GCL\+? \d{1,2}(;[A-Za-z]+ ([0-9a-f]-([0-9a-f]{2})+|-)( \d+){4})*$")
+clear_command_latency_pattern = re.compile(rb"^RES CCL$")
+clear_stored_results_pattern = re.compile(rb"^RES CSR$")
+task_stats_pattern = re.compile(rb"^RES GTS\+? [A-Za-z]+ \d+ \d+ \d+(;[A-Za-z]+ \d+ \d+ \d+)*$")
+profile_pattern = re.compile(rb"^RES GPF\+? \d+ \d+(;[A-Za-z]+ \d+ \d+ \d+ \d+ ([0-9a-f]-([0-9a-f]{4})+|-))*$")
+clear_profile_pattern = re.compile(rb"^RES CPF$")
+duty_cycle_pattern = re.compile(rb"^RES GDC \d+ \d+ \d{1,4} \d+$")
+boot_timeline_pattern = re.compile(rb"^RES GBT\+? [A-Za-z]+ \d+(;[A-Za-z]+ \d+)*$")
+batch_pattern = re.compile(rb"^RES BAT 2 2 NOP GBI \d+$")
+batch_failure_pattern = re.compile(rb"^RES BAT 1 3 NOP$")
 
 # Sequence counter for commands
 
@@ -121,6 +139,38 @@ def issue(command, new_command_count=None):
     command_port.write(FEND + REMOTE_FRAME + signature + command + FEND)
 
 
+## Issue ground command with binary signature
+#
+# The HMAC, salt, and big endian sequence are sent as bytes, so the frame must be KISS escaped
+#
+# Sent directly to Serial1; over the air this depends on the Radio Board forwarding type 0xAB
+# frames, see the Flight README
+#
+def issue_binary(command, new_command_count=None):
+
+    global command_count
+    if new_command_count is not None:
+        command_count = new_command_count
+    else:
+        command_count += 1
+    salt = (secrets.token_bytes(8))
+    secret = open("secret.txt", "rb").read()
+    sequence = command_count.to_bytes(4, "big")
+    command = command.encode("utf-8")
+    computed_hmac = hmac.new(secret, digestmod=hashlib.blake2s)
+    computed_hmac.update(salt)
+    computed_hmac.update(sequence)
+    computed_hmac.update(command)
+    signature = computed_hmac.digest() + salt + sequence
+    command_port.write(FEND + REMOTE_BINARY_FRAME + escape(signature + command) + FEND)
+
+
+## KISS escape frame content
+#
+def escape(content):
+    return content.replace(FESC, FESC + TFESC).replace(FEND, FESC + TFEND)
+
+
 ## Issue local command
 #
 # Local commands must be framed with KISS encoding
@@ -129,6 +179,27 @@ def local(command):
     command_port.write(FEND + LOCAL_FRAME + command.encode("utf-8") + FEND)
 
 
+## Negotiate baud rate
+#
+# Act as the Radio Board: accept the proposed speed, switch the command port,
+# and answer the probe at the new speed unless confirm is False
+#
+def accept_baud_rate(baud_rate, confirm=True):
+    rate = str(baud_rate).encode("utf-8")
+    proposal = command_port.read_until(expected=FEND) + command_port.read_until(expected=FEND)
+    if proposal[1:2] != MODIFY_BAUD_RATE or proposal[2:-1] != rate:
+        return False
+    local(f"RES 1C {baud_rate}")
+    command_port.flush()
+    command_port.baudrate = baud_rate
+    probe = command_port.read_until(expected=FEND) + command_port.read_until(expected=FEND)
+    if probe[1:2] != MODIFY_BAUD_RATE or probe[2:-1] != rate:
+        return False
+    if confirm:
+        local(f"RES 1C {baud_rate}")
+    return True
+
+
 ## Collect message response
 #
 # Commands generate one or more messages, captured individually
@@ -0,0 +1,22 @@
+##
+# @brief Test beacon decoder
+# @author Lee A. Congdon (lee@silversat.org)
+
+"""Test beacon decoder"""
+
+import beacon
+
+
+## Test beacon decoding
+#
+class TestBeacon:
+    """Test beacon decoding"""
+
+    def test_tables(self):
+        assert len(beacon.tables["power"]) == 5
+        assert len(beacon.tables["avionics"]) == 11
+        assert len(beacon.tables["payload"]) == 30
+
+    def test_decode(self):
+        assert beacon.decode(b"EEE") == ("good", "everything_ok", "none")
+        assert beacon.decode(b"AT4") == ("unknown", "watchdog_reset", "photo_timeout")
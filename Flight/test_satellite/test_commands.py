@@ -6,6 +6,7 @@
 
 import common
 import time
+import datetime
 
 ## Test commands
 #
@@ -26,6 +27,27 @@ class TestCommands:
         message = common.collect_message()
         assert common.verify_message(message, common.set_clock_pattern)
 
+    def test_set_realtime_clock_iso(self):
+        common.issue(f"SetClock {datetime.datetime.now(datetime.timezone.utc).strftime('%Y%m%dT%H%M%SZ')}")
+        time.sleep(5)
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.set_clock_pattern)
+
+    def test_set_realtime_clock_epoch(self):
+        common.issue(f"SetClock {int(time.time())}")
+        time.sleep(5)
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.set_clock_pattern)
+
+    def test_pictimes_invalid_day(self):
+        common.issue("PicTimes 2027 02 29 12 00 00")
+        message = common.collect_message()
+        assert common.verify_message(message, common.negative_acknowledgment_pattern)
+
     def test_set_beacon_interval(self):
         common.issue("BeaconSp 60")
         time.sleep(5)
@@ -76,6 +98,14 @@ class TestCommands:
         message = common.collect_message()
         assert common.verify_message(message, common.payload_queue_pattern)
 
+    def test_get_payload_queue_compact(self):
+        common.issue("GetPayloadQueue Compact")
+        time.sleep(5)
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.payload_queue_compact_pattern)
+
     def test_get_telemetry(self):
         common.issue("GetTelemetry")
         time.sleep(5)
@@ -100,6 +130,14 @@ class TestCommands:
         message = common.collect_message()
         assert common.verify_message(message, common.comms_pattern)
 
+    def test_get_link_stats(self):
+        common.issue("GetLinkStats")
+        time.sleep(5)
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.link_stats_pattern)
+
     def test_get_beacon_interval(self):
         common.issue("GetBeaconInterval")
         time.sleep(5)
@@ -143,6 +181,118 @@ class TestCommands:
         message = common.collect_message()
         assert common.verify_message(message, common.no_operation_pattern)
 
+    def test_no_operate_binary(self):
+        common.issue_binary("NoOperate")
+        time.sleep(5)
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.no_operation_pattern)
+
+    def test_store_command(self):
+        common.issue("ClearStoredResults")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.clear_stored_results_pattern)
+        common.issue(f"StoreCommand {common.now30s()} NoOperate")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.store_command_pattern)
+        common.issue("GetStoredCommands")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.stored_commands_pattern)
+        time.sleep(45)
+        common.issue("GetStoredResults")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.stored_no_operate_pattern)
+        common.issue("ClearStoredResults")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.clear_stored_results_pattern)
+
+    def test_clear_stored_commands(self):
+        common.issue(f"StoreCommand {common.now1m()} BeaconSp 0")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.store_command_pattern)
+        common.issue("ClearStoredCommands")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.clear_stored_commands_pattern)
+
+    def test_command_latency(self):
+        common.issue("ClearCommandLatency")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.clear_command_latency_pattern)
+        common.issue("GetCommandLatency")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.command_latency_pattern)
+
+    def test_get_task_stats(self):
+        common.issue("GetTaskStats")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.task_stats_pattern)
+
+    def test_profile(self):
+        common.issue("ClearProfile")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.clear_profile_pattern)
+        common.issue("GetProfile")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.profile_pattern)
+
+    def test_get_duty_cycle(self):
+        common.issue("GetDutyCycle")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.duty_cycle_pattern)
+
+    def test_get_boot_timeline(self):
+        common.issue("GetBootTimeline")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.boot_timeline_pattern)
+
+    def test_batch(self):
+        common.issue("Batch\nNoOperate\nGetBeaconInterval")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.batch_pattern)
+
+    def test_batch_failure(self):
+        common.issue("Batch\nNoOperate\nNotACommand\nNoOperate\n")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.batch_failure_pattern)
+
+    def test_unmarked_batch(self):
+        common.issue("NoOperate\nGetBeaconInterval")
+        message = common.collect_message()
+        assert common.verify_message(message, common.negative_acknowledgment_pattern)
+
     def test_send_packet(self):
         common.issue("SendTestPacket")
         time.sleep(5)
@@ -178,4 +328,37 @@ class TestCommands:
         # message = common.collect_message()
         # assert common.verify_message(message, common.acknowledgment_pattern)
         # message = common.collect_message()
-        # assert common.verify_message(message, common.current_rssi_pattern)
\ No newline at end of file
+        # assert common.verify_message(message, common.current_rssi_pattern)
+    def test_modify_baud(self):
+        common.issue("ModifyBaud 57600")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.modify_baud_pattern)
+        assert common.accept_baud_rate(57600)
+        common.issue("NoOperate")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.no_operation_pattern)
+        common.issue(f"ModifyBaud {common.BAUDRATE}")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.modify_baud_pattern)
+        assert common.accept_baud_rate(common.BAUDRATE)
+
+    def test_modify_baud_fallback(self):
+        common.issue("ModifyBaud 115200")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.modify_baud_pattern)
+        assert common.accept_baud_rate(115200, confirm=False)
+        time.sleep(5) # Avionics Board returns to the initial speed without confirmation
+        common.command_port.baudrate = common.BAUDRATE
+        common.issue("NoOperate")
+        message = common.collect_message()
+        assert common.verify_message(message, common.acknowledgment_pattern)
+        message = common.collect_message()
+        assert common.verify_message(message, common.no_operation_pattern)
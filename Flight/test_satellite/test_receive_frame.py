@@ -74,5 +74,13 @@ class TestReceiveFrame:
         common.command_port.write(common.FEND + common.REMOTE_FRAME + common.FESC + common.REMOTE_FRAME + common.FEND)
         message = common.collect_message()
         assert common.verify_message(message, common.no_response_pattern)
-    
 
+    def test_burst(self):
+        common.issue("NoOperate")
+        common.issue("NoOperate")
+        common.issue("NoOperate")
+        for _ in range(3):
+            message = common.collect_message()
+            assert common.verify_message(message, common.acknowledgment_pattern)
+            message = common.collect_message()
+            assert common.verify_message(message, common.no_operation_pattern)
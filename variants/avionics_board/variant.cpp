@@ -139,11 +139,18 @@ void SERCOM0_Handler()
 
 Uart Serial1(&sercom1, PIN_SERIAL1_RX, PIN_SERIAL1_TX, PAD_SERIAL1_RX, PAD_SERIAL1_TX);
 
-void SERCOM1_Handler()
+// Serial1 interrupt service is weak so a sketch can replace it
+
+void __attribute__((weak)) Serial1_Handler()
 {
   Serial1.IrqHandler();
 }
 
+void SERCOM1_Handler()
+{
+  Serial1_Handler();
+}
+
 Uart Serial2(&sercom5, PIN_SERIAL2_RX, PIN_SERIAL2_TX, PAD_SERIAL2_RX, PAD_SERIAL2_TX);
 
 void SERCOM5_Handler()
@@ -156,6 +156,8 @@ static const uint8_t ATN = PIN_ATN;
 #define PIN_SERIAL1_TX       (13ul)
 #define PAD_SERIAL1_TX       (UART_TX_PAD_0)
 #define PAD_SERIAL1_RX       (SERCOM_RX_PAD_1)
+#define PERIPH_SERIAL1       sercom1
+#define SERCOM_SERIAL1       SERCOM1  // registers of PERIPH_SERIAL1
 
 // Serial2
 #define PIN_SERIAL2_RX       (6ul)
@@ -133,11 +133,18 @@ Uart Serial2( &sercom5, PIN_SERIAL2_RX, PIN_SERIAL2_TX, PAD_SERIAL2_RX, PAD_SERI
 //the next line is not needed as long as the number of wire interfaces is greater than 1 in the header file
 //TwoWire Wire1(&sercom2, PIN_WIRE_SDA1, PIN_WIRE_SCL1);
 
-void SERCOM0_Handler()
+// Serial1 interrupt service is weak so a sketch can replace it
+
+void __attribute__((weak)) Serial1_Handler()
 {
   Serial1.IrqHandler();
 }
 
+void SERCOM0_Handler()
+{
+  Serial1_Handler();
+}
+
 void SERCOM1_Handler()
 {
   Serial0.IrqHandler();
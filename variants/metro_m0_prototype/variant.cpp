@@ -120,8 +120,15 @@ SERCOM sercom5( SERCOM5 ) ;
 
 Uart Serial1( &sercom0, PIN_SERIAL1_RX, PIN_SERIAL1_TX, PAD_SERIAL1_RX, PAD_SERIAL1_TX ) ;
 
-void SERCOM0_Handler()
+// Serial1 interrupt service is weak so a sketch can replace it
+
+void __attribute__((weak)) Serial1_Handler()
 {
   Serial1.IrqHandler();
 }
 
+void SERCOM0_Handler()
+{
+  Serial1_Handler();
+}
+
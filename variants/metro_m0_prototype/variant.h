@@ -139,6 +139,8 @@ static const uint8_t ATN = PIN_ATN;
 #define PIN_SERIAL1_TX       (1ul)
 #define PAD_SERIAL1_TX       (UART_TX_PAD_2)
 #define PAD_SERIAL1_RX       (SERCOM_RX_PAD_3)
+#define PERIPH_SERIAL1       sercom0
+#define SERCOM_SERIAL1       SERCOM0  // registers of PERIPH_SERIAL1
 
 /*
  * SPI Interfaces